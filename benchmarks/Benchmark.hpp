@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns::bench {
+
+    struct Result {
+        std::string benchmark;      ///< Name of the benchmark function
+        std::string name;           ///< Name of the measured case
+        std::size_t iterations;
+        double mean_us;
+        double min_us;
+        double max_us;
+        std::vector<std::pair<std::string, double>> counters;  ///< Values reported with State::counter
+    };
+
+    class State {
+    public:
+        explicit State(std::string benchmark);
+
+        /**
+         * \brief Runs a function multiple times and records its timings
+         *
+         * The function is run once before the measures to warm up the caches.
+         *
+         * \param name Name of the measured case
+         * \param iterations Number of timed runs
+         * \param fn Function to measure
+         */
+        template <typename F>
+        void measure(const std::string& name, std::size_t iterations, F&& fn);
+
+        /**
+         * \brief Attaches a value to the last measured case (work done, items moved, ...)
+         *
+         * \param name Name of the counter
+         * \param value Value of the counter
+         */
+        void counter(const std::string& name, double value);
+
+        auto getResults() const -> const std::vector<Result>&;
+
+    private:
+        std::string m_benchmark;
+        std::vector<Result> m_results;
+    };
+
+    using Function = void(*)(State&);
+
+    /**
+     * \brief Get all the registered benchmarks, in registration order
+     */
+    auto getBenchmarks() -> std::vector<std::pair<std::string, Function>>&;
+
+    /**
+     * \brief Creates an empty directory in the system temporary directory, for the files used by a benchmark
+     *
+     * \param name Name of the directory, its previous content is removed
+     *
+     * \return Absolute path of the directory
+     */
+    auto makeTemporaryDirectory(const std::string& name) -> std::string;
+
+    struct Registration {
+        Registration(const char* name, Function fn);
+    };
+
+    /**
+     * \brief Prevents the compiler from optimizing away a computed value
+     */
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const volatile void* sink;
+        sink = &value;
+#endif
+    }
+
+    template <typename F>
+    void State::measure(const std::string& name, std::size_t iterations, F&& fn) {
+        using clock = std::chrono::steady_clock;
+        fn();
+        Result result{m_benchmark, name, std::max<std::size_t>(iterations, 1), 0., 0., 0., {}};
+        double total = 0.;
+        for (std::size_t i = 0; i < result.iterations; ++i) {
+            auto start = clock::now();
+            fn();
+            auto us = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+            total += us;
+            result.min_us = i == 0 ? us : std::min(result.min_us, us);
+            result.max_us = std::max(result.max_us, us);
+        }
+        result.mean_us = total / static_cast<double>(result.iterations);
+        m_results.push_back(std::move(result));
+    }
+
+}
+
+#define NS_BENCHMARK(name) \
+    static void name(ns::bench::State&); \
+    static const ns::bench::Registration name##_registration(#name, name); \
+    static void name(ns::bench::State& state)
@@ -0,0 +1,35 @@
+#include <SFML/Graphics/Texture.hpp>
+
+#include <NasNas/core/graphics/BitmapFont.hpp>
+#include <NasNas/core/graphics/BitmapText.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Regenerates the vertices of BitmapTexts after their string changed (BitmapText::updateVertices,
+ * called lazily by getLocalBounds), as for a score or a dialog box updated each frame.
+ */
+NS_BENCHMARK(BitmapText) {
+    // the glyphs texture is never loaded, only the vertices are generated
+    sf::Texture texture;
+    ns::BitmapFont font;
+    font.loadFromTexture(texture, {8, 8}, 5);
+    font.setCharacters(L"_ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789.,:;!?-+=");
+
+    const std::string line = "The quick brown fox jumps over the lazy dog 0123456789.\n";
+    for (std::size_t lines : {1u, 10u, 100u}) {
+        std::string string;
+        for (std::size_t i = 0; i < lines; ++i)
+            string += line;
+        sf::String strings[2] = {string, string + "!"};
+
+        ns::BitmapText text;
+        text.setFont(font);
+        std::size_t i = 0;
+        state.measure("updateVertices, " + std::to_string(lines) + " lines", 1000, [&] {
+            text.setString(strings[i++ % 2]);
+            ns::bench::doNotOptimize(text.getLocalBounds());
+        });
+        state.counter("characters", double(string.size()));
+    }
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <NasNas/tween/Easing.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Evaluates the easing functions on 4096 progress values, one at a time with the scalar functions of Easing.cpp
+ * and in batches with the SIMD `easing::evaluate`, for one function of each family.
+ *
+ * The accuracy case compares the batches to the scalar functions on 2^20 values in [0, 1], the counters
+ * are the maximum absolute difference of each family.
+ */
+NS_BENCHMARK(Easing) {
+    using ns::tween::EasingType;
+    const std::vector<std::pair<std::string, EasingType>> families = {
+        {"quadratic", EasingType::QuadraticInOut},
+        {"cubic", EasingType::CubicOut},
+        {"sinusoidal", EasingType::SinusoidalInOut},
+        {"exponential", EasingType::ExponentialInOut},
+        {"circular", EasingType::CircularOut},
+        {"bounce", EasingType::BounceOut},
+        {"back", EasingType::BackInOut},
+        {"elastic", EasingType::ElasticOut}
+    };
+
+    constexpr std::size_t count = 4096;
+    std::vector<float> t(count), result(count);
+    for (std::size_t i = 0; i < count; ++i)
+        t[i] = float(i) / float(count - 1);
+
+    for (const auto& [name, type] : families) {
+        state.measure(name + " scalar", 200, [&, type=type] {
+            for (std::size_t i = 0; i < count; ++i)
+                result[i] = ns::easing::evaluate(type, t[i]);
+            ns::bench::doNotOptimize(result.data());
+        });
+        state.measure(name + " batch", 200, [&, type=type] {
+            ns::easing::evaluate(type, t.data(), result.data(), count);
+            ns::bench::doNotOptimize(result.data());
+        });
+        state.counter("values", double(count));
+        state.counter("batch width", double(ns::easing::getBatchWidth()));
+    }
+
+    constexpr std::size_t samples = 1u << 20;
+    std::vector<float> progress(samples), batch(samples);
+    for (std::size_t i = 0; i < samples; ++i)
+        progress[i] = float(i) / float(samples - 1);
+    std::vector<double> errors(families.size());
+    state.measure("accuracy", 1, [&] {
+        for (std::size_t f = 0; f < families.size(); ++f) {
+            const auto type = families[f].second;
+            ns::easing::evaluate(type, progress.data(), batch.data(), samples);
+            errors[f] = 0.;
+            for (std::size_t i = 0; i < samples; ++i)
+                errors[f] = std::max(errors[f], std::abs(double(batch[i]) - double(ns::easing::evaluate(type, progress[i]))));
+        }
+    });
+    for (std::size_t f = 0; f < families.size(); ++f)
+        state.counter(families[f].first + " max error", errors[f]);
+}
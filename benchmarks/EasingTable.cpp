@@ -0,0 +1,60 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <NasNas/tween/EasingTable.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Evaluates 4096 progress values with the easing functions of Easing.cpp and with lookup tables of 256 and
+ * 1024 samples, for one function of each family and for a custom elastic easing (its table is built at runtime).
+ *
+ * The counters are the maximum difference between the tables and the functions, measured on 2^20 values in [0, 1].
+ */
+NS_BENCHMARK(EasingTable) {
+    using ns::tween::EasingType;
+    using Function = float(*)(float);
+    struct Family {
+        std::string name;
+        Function function;
+        ns::EasingTable<256> table_256;
+        ns::EasingTable<1024> table_1024;
+    };
+    const std::vector<Family> families = {
+        {"quadratic", ns::easing::quadraticInOut, ns::easing_table<EasingType::QuadraticInOut>, ns::easing_table<EasingType::QuadraticInOut, 1024>},
+        {"cubic", ns::easing::cubicOut, ns::easing_table<EasingType::CubicOut>, ns::easing_table<EasingType::CubicOut, 1024>},
+        {"sinusoidal", ns::easing::sinusoidalInOut, ns::easing_table<EasingType::SinusoidalInOut>, ns::easing_table<EasingType::SinusoidalInOut, 1024>},
+        {"exponential", ns::easing::exponentialInOut, ns::easing_table<EasingType::ExponentialInOut>, ns::easing_table<EasingType::ExponentialInOut, 1024>},
+        {"circular", ns::easing::circularOut, ns::easing_table<EasingType::CircularOut>, ns::easing_table<EasingType::CircularOut, 1024>},
+        {"bounce", ns::easing::bounceOut, ns::easing_table<EasingType::BounceOut>, ns::easing_table<EasingType::BounceOut, 1024>},
+        {"back", ns::easing::backInOut, ns::easing_table<EasingType::BackInOut>, ns::easing_table<EasingType::BackInOut, 1024>},
+        {"elastic", ns::easing::elasticOut, ns::easing_table<EasingType::ElasticOut>, ns::easing_table<EasingType::ElasticOut, 1024>},
+        {"custom elastic", ns::easing::custom::elasticOut<40>, ns::EasingTable<256>(ns::easing::custom::elasticOut<40>), ns::EasingTable<1024>(ns::easing::custom::elasticOut<40>)}
+    };
+
+    constexpr std::size_t count = 4096;
+    std::vector<float> t(count), result(count);
+    for (std::size_t i = 0; i < count; ++i)
+        t[i] = float(i) / float(count - 1);
+
+    for (const auto& family : families) {
+        state.measure(family.name + " function", 200, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                result[i] = family.function(t[i]);
+            ns::bench::doNotOptimize(result.data());
+        });
+        state.measure(family.name + " table 256", 200, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                result[i] = family.table_256(t[i]);
+            ns::bench::doNotOptimize(result.data());
+        });
+        state.measure(family.name + " table 1024", 200, [&] {
+            for (std::size_t i = 0; i < count; ++i)
+                result[i] = family.table_1024(t[i]);
+            ns::bench::doNotOptimize(result.data());
+        });
+        state.counter(family.name + " max error 256", double(family.table_256.getMaxError(family.function, 1u << 20)));
+        state.counter(family.name + " max error 1024", double(family.table_1024.getMaxError(family.function, 1u << 20)));
+    }
+}
@@ -0,0 +1,67 @@
+#include <NasNas/ecs/Registry.hpp>
+#include <NasNas/core/data/Random.hpp>
+
+#include "Benchmark.hpp"
+
+namespace {
+    struct Position { float x, y; };
+    struct Velocity { float x, y; };
+    struct Health { int value; };
+}
+
+/**
+ * Iterates the components of 100k entities through Registry views, the way systems do each update :
+ * - every entity has a Position, 3/4 of them a Velocity, and 1/10 of them a Health
+ * - a view is driven by its smallest pool, and tests the other pools for each entity
+ */
+NS_BENCHMARK(EcsViews) {
+    constexpr std::size_t count = 100000;
+
+    ns::ecs::detail::Registry<ns::ecs::Entity> registry;
+    ns::utils::Random random(3);
+    state.measure("create and attach 100k", 10, [&] {
+        ns::ecs::detail::Registry<ns::ecs::Entity> reg;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto ent = reg.create();
+            reg.attach<Position>(ent, Position{0.f, 0.f});
+            if (i % 4 != 0)
+                reg.attach<Velocity>(ent, Velocity{1.f, 1.f});
+        }
+        ns::bench::doNotOptimize(reg.count());
+    });
+
+    for (std::size_t i = 0; i < count; ++i) {
+        auto ent = registry.create();
+        registry.attach<Position>(ent, Position{random.uniform(0.f, 1000.f), random.uniform(0.f, 1000.f)});
+        if (i % 4 != 0)
+            registry.attach<Velocity>(ent, Velocity{random.uniform(-1.f, 1.f), random.uniform(-1.f, 1.f)});
+        if (i % 10 == 0)
+            registry.attach<Health>(ent, Health{100});
+    }
+
+    state.measure("view<Position>", 100, [&] {
+        float sum = 0.f;
+        registry.run<Position>([&](Position& pos) { sum += pos.x; });
+        ns::bench::doNotOptimize(sum);
+    });
+
+    state.measure("view<Position, Velocity>", 100, [&] {
+        registry.run<Position, Velocity>([](Position& pos, Velocity& vel) {
+            pos.x += vel.x;
+            pos.y += vel.y;
+        });
+    });
+
+    state.measure("view<Position, Velocity, Health>", 100, [&] {
+        int sum = 0;
+        registry.run<Position, Velocity, Health>([&](Position&, Velocity&, Health& health) { sum += health.value; });
+        ns::bench::doNotOptimize(sum);
+    });
+
+    state.measure("view<Position, Velocity>::get", 100, [&] {
+        auto view = registry.view<Position, Velocity>();
+        float sum = 0.f;
+        view.for_each([&](ns::ecs::Entity ent) { sum += view.get<Velocity>(ent).x; });
+        ns::bench::doNotOptimize(sum);
+    });
+}
@@ -0,0 +1,69 @@
+#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <NasNas/core/Layer.hpp>
+#include <NasNas/core/data/Random.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Culls 100k static 16x16 drawables spread on a 16000x16000 world
+ * with a 1280x720 view sweeping the world, as Scene::draw does each frame.
+ */
+NS_BENCHMARK(LayerCulling) {
+    constexpr std::size_t count = 100000;
+    constexpr float world_size = 16000.f;
+    const sf::Vector2f view_size = {1280.f, 720.f};
+
+    ns::utils::Random random(42);
+    std::vector<sf::RectangleShape> shapes(count, sf::RectangleShape({16.f, 16.f}));
+    for (auto& shape : shapes)
+        shape.setPosition(random.uniform(0.f, world_size), random.uniform(0.f, world_size));
+
+    ns::Layer layer("bench");
+    for (const auto& shape : shapes)
+        layer.add(shape);
+
+    std::vector<sf::FloatRect> views;
+    for (int i = 0; i < 64; ++i)
+        views.emplace_back(sf::Vector2f(random.uniform(0.f, world_size), random.uniform(0.f, world_size)), view_size);
+
+    std::vector<const sf::Drawable*> visible;
+    visible.reserve(count);
+
+    state.measure("per drawable bounds (64 views)", 10, [&] {
+        for (const auto& view : views) {
+            visible.clear();
+            for (const auto* dr : layer.allDrawables())
+                if (view.intersects(layer.getDrawableBounds(dr)))
+                    visible.push_back(dr);
+            ns::bench::doNotOptimize(visible.size());
+        }
+    });
+
+    state.measure("build spatial index", 5, [&] {
+        layer.enableSpatialIndex(256.f);
+    });
+
+    for (auto cell_size : {64.f, 256.f, 1024.f}) {
+        layer.enableSpatialIndex(cell_size);
+        state.measure("spatial index, cell " + std::to_string(int(cell_size)) + " (64 views)", 100, [&] {
+            for (const auto& view : views) {
+                visible.clear();
+                layer.getDrawablesIn(view, visible);
+                ns::bench::doNotOptimize(visible.size());
+            }
+        });
+    }
+
+    // whole world visible, worst case for the index
+    const sf::FloatRect world(0.f, 0.f, world_size, world_size);
+    state.measure("spatial index, whole world visible", 5, [&] {
+        visible.clear();
+        layer.getDrawablesIn(world, visible);
+        ns::bench::doNotOptimize(visible.size());
+    });
+
+    state.measure("update all bounds", 5, [&] {
+        layer.updateBounds();
+    });
+}
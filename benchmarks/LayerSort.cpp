@@ -0,0 +1,50 @@
+#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <NasNas/core/Layer.hpp>
+#include <NasNas/core/data/Random.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Y-sorts layers of shapes shuffled before each sort, then layers where
+ * a quarter of the shapes move by a few pixels between two sorts (top down game).
+ */
+NS_BENCHMARK(LayerYSort) {
+    for (std::size_t count : {100u, 1000u, 10000u, 100000u}) {
+        ns::utils::Random random(7);
+        std::vector<sf::RectangleShape> shapes(count, sf::RectangleShape({16.f, 16.f}));
+        ns::Layer layer("bench");
+        for (const auto& shape : shapes)
+            layer.add(shape);
+
+        state.measure("ySort, " + std::to_string(count) + " shuffled", count >= 100000 ? 10 : 100, [&] {
+            for (auto& shape : shapes)
+                shape.setPosition(0.f, random.uniform(0.f, 10000.f));
+            layer.ySort();
+        });
+    }
+
+    for (auto mode : {ns::Layer::YSortMode::Full, ns::Layer::YSortMode::Incremental}) {
+        for (std::size_t count : {1000u, 10000u, 100000u}) {
+            ns::utils::Random random(7);
+            std::vector<sf::RectangleShape> shapes(count, sf::RectangleShape({16.f, 16.f}));
+            ns::Layer layer("bench");
+            layer.setYSortMode(mode);
+            for (auto& shape : shapes) {
+                shape.setPosition(0.f, random.uniform(0.f, 10000.f));
+                layer.add(shape);
+            }
+            layer.ySort();
+
+            std::size_t moved = 0, sorts = 0;
+            auto name = std::string(mode == ns::Layer::YSortMode::Full ? "ySort full, " : "ySort incremental, ");
+            state.measure(name + std::to_string(count) + " coherent", count >= 100000 ? 20 : 100, [&] {
+                for (std::size_t i = 0; i < count; i += 4)
+                    shapes[i].move(0.f, random.uniform(-2.f, 2.f));
+                moved += layer.ySort();
+                sorts++;
+            });
+            state.counter("drawables moved per sort", double(moved/sorts));
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <NasNas/core/data/FrameBuffers.hpp>
+
+#include "Benchmark.hpp"
+
+namespace {
+    using clock = std::chrono::steady_clock;
+
+    // keeps the thread busy, sleeping is too imprecise for loads of a few milliseconds
+    void spin(double ms) {
+        const auto end = clock::now() + std::chrono::duration<double, std::milli>(ms);
+        while (clock::now() < end) {}
+    }
+
+    struct Snapshot {
+        std::vector<sf::Vertex> vertices;
+        sf::Transform view;
+    };
+
+    // update load : moves the objects, then copies their quads in the snapshot
+    void update(std::vector<sf::Vector2f>& positions, Snapshot& snapshot, double load_ms) {
+        spin(load_ms);
+        snapshot.vertices.clear();
+        for (auto& position : positions) {
+            position.x += 1.f;
+            snapshot.vertices.emplace_back(position);
+            snapshot.vertices.emplace_back(position + sf::Vector2f(16.f, 0.f));
+            snapshot.vertices.emplace_back(position + sf::Vector2f(16.f, 16.f));
+            snapshot.vertices.emplace_back(position + sf::Vector2f(0.f, 16.f));
+        }
+        snapshot.view = sf::Transform().translate(-positions.front());
+    }
+
+    // render load : only reads the snapshot
+    void render(const Snapshot& snapshot, double load_ms) {
+        spin(load_ms);
+        float sum = 0.f;
+        for (const auto& vertex : snapshot.vertices)
+            sum += snapshot.view.transformPoint(vertex.position).x;
+        ns::bench::doNotOptimize(sum);
+    }
+}
+
+/**
+ * Runs frames made of a synthetic update load and a synthetic render load (milliseconds of busy work,
+ * plus 10k quads copied in a snapshot), on a single thread then on an update and a render thread
+ * exchanging snapshots through ns::FrameBuffers. Measures the time to update 60 frames.
+ */
+NS_BENCHMARK(RenderThread) {
+    constexpr std::size_t frames = 60;
+    constexpr std::size_t objects = 10000;
+
+    for (auto [update_ms, render_ms] : {std::pair{2., 2.}, std::pair{1., 4.}, std::pair{4., 1.}}) {
+        auto loads = " (update " + std::to_string(int(update_ms)) + "ms, render " + std::to_string(int(render_ms)) + "ms)";
+        std::vector<sf::Vector2f> positions(objects);
+
+        Snapshot snapshot;
+        state.measure("single thread" + loads, 5, [&] {
+            for (std::size_t i = 0; i < frames; ++i) {
+                update(positions, snapshot, update_ms);
+                render(snapshot, render_ms);
+            }
+        });
+
+        for (std::size_t buffers : {2u, 3u}) {
+            std::size_t rendered = 0, dropped = 0, runs = 0;
+            state.measure("render thread, " + std::to_string(buffers) + " buffers" + loads, 5, [&] {
+                ns::FrameBuffers<Snapshot> snapshots(buffers);
+                std::thread render_thread([&] {
+                    while (auto* frame = snapshots.beginRead()) {
+                        render(*frame, render_ms);
+                        snapshots.endRead();
+                        rendered++;
+                    }
+                });
+                for (std::size_t i = 0; i < frames; ++i) {
+                    update(positions, snapshots.beginWrite(), update_ms);
+                    snapshots.endWrite();
+                }
+                snapshots.stop();
+                render_thread.join();
+                dropped += snapshots.getDroppedCount();
+                runs++;
+            });
+            state.counter("frames rendered per run", double(rendered/runs));
+            state.counter("frames dropped per run", double(dropped/runs));
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#include <filesystem>
+#include <limits>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/Random.hpp>
+#include <NasNas/core/data/ThreadPool.hpp>
+#include <NasNas/reslib/RawTexture.hpp>
+#include <NasNas/reslib/ResourceManager.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Loads a generated assets directory (4 sub directories of 16 noisy 256x256 PNGs) with the ResourceManager :
+ * - lazily, only the directory tree is walked
+ * - with autoload, the images are decoded in parallel on the default ThreadPool and uploaded
+ * - asynchronously, polling the LoadingTask like a loading screen would each frame
+ * - decoding alone with sf::Image on a single thread, the startup time before parallel loading
+ * - from a pack of the same directory, lazily and with autoload
+ * - textures lookups, from their path and from their interned ResourceId
+ * - levels changes under a memory budget of one level, the textures of the previous level are evicted (--gpu only)
+ * - the same images converted to raw textures, read sequentially and loaded with autoload, from the directory
+ *   and from an uncompressed pack, uploaded from the mapped file
+ *
+ * Headless apps do not upload the textures, so the autoload and async cases only measure the
+ * upload with --gpu. The lazy case and the decode case are the same in both modes.
+ */
+NS_BENCHMARK(ResourceManager) {
+    constexpr unsigned dirs = 4, images = 16, size = 256;
+    const auto assets = ns::bench::makeTemporaryDirectory("nasnas_bench_resources");
+
+    ns::utils::Random random(9);
+    sf::Image image;
+    image.create(size, size);
+    std::vector<std::string> files;
+    for (unsigned d = 0; d < dirs; ++d) {
+        auto dir = assets + "/dir" + std::to_string(d);
+        std::filesystem::create_directories(dir);
+        for (unsigned i = 0; i < images; ++i) {
+            // noise makes the PNG compression, and the decoding, close to the one of real sprites
+            for (unsigned y = 0; y < size; ++y)
+                for (unsigned x = 0; x < size; ++x)
+                    image.setPixel(x, y, sf::Color(random.next() & 0xffu, (x+y) & 0xffu, y & 0xffu, 255));
+            files.push_back(dir + "/image" + std::to_string(i) + ".png");
+            image.saveToFile(files.back());
+        }
+    }
+
+    state.measure("load lazily", 20, [&] {
+        ns::Res::load(assets, false);
+    });
+    state.counter("files", double(files.size()));
+
+    const std::string upload = ns::Settings::getConfig().headless ? " (no upload)" : "";
+    state.measure("load with autoload" + upload, 5, [&] {
+        ns::Res::load(assets, true);
+    });
+    state.counter("threads", double(ns::ThreadPool::getDefault().getWorkersCount()));
+
+    std::size_t notifications = 0, runs = 0;
+    state.measure("load async" + upload, 5, [&] {
+        auto task = ns::Res::loadAsync(assets, [&](std::size_t, std::size_t) { notifications++; });
+        // at most 4 uploads per update, as a loading screen would do each frame
+        while (!task.update(4));
+        runs++;
+    });
+    state.counter("progress callbacks per load", double(notifications) / double(runs));
+
+    const auto pack = assets + ns::Pack::Extension;
+    ns::Pack::build(assets, pack);
+    state.measure("load pack lazily", 20, [&] {
+        ns::Res::load(pack, false);
+    });
+    state.measure("load pack with autoload" + upload, 5, [&] {
+        ns::Res::load(pack, true);
+    });
+
+    // paths relative to the root, as used in game code
+    std::vector<std::string> paths;
+    std::vector<ns::ResourceId> ids;
+    for (unsigned d = 0; d < dirs; ++d)
+        for (unsigned i = 0; i < images; ++i)
+            paths.push_back("dir" + std::to_string(d) + "/image" + std::to_string(i) + ".png");
+    for (const auto& path : paths)
+        ids.push_back(ns::Res::getId(path));
+    state.measure("get textures from path", 1000, [&] {
+        for (const auto& path : paths)
+            ns::bench::doNotOptimize(&ns::Res::getTexture(path));
+    });
+    state.counter("lookups", double(paths.size()));
+    state.measure("get textures from ResourceId", 1000, [&] {
+        for (const auto& id : ids)
+            ns::bench::doNotOptimize(&ns::Res::getTexture(id));
+    });
+
+    if (!ns::Settings::getConfig().headless) {
+        // each directory is a level, its textures are held by handles while it is played
+        ns::Res::load(assets, false);
+        ns::Res::setMemoryBudget(std::size_t(images) * size * size * 4);
+        std::vector<ns::TextureHandle> level;
+        unsigned current = 0;
+        state.measure("change level under memory budget", 20, [&] {
+            level.clear();
+            for (unsigned i = 0; i < images; ++i)
+                level.push_back(ns::Res::acquireTexture(paths[current * images + i]));
+            current = (current + 1) % dirs;
+        });
+        const auto stats = ns::Res::getStats();
+        state.counter("evictions", double(stats.evictions));
+        state.counter("resident textures bytes", double(stats.textures_bytes));
+        level.clear();
+        ns::Res::setMemoryBudget(std::numeric_limits<std::size_t>::max());
+    }
+
+    state.measure("decode images sequentially", 5, [&] {
+        sf::Image decoded;
+        for (const auto& file : files)
+            decoded.loadFromFile(file);
+        ns::bench::doNotOptimize(decoded.getSize());
+    });
+    state.counter("decoded bytes", double(files.size() * size * size * 4));
+
+    // the raw textures replace the images in the directory
+    for (const auto& file : files) {
+        image.loadFromFile(file);
+        ns::RawTexture::convert(image, file + ns::RawTexture::Extension);
+    }
+    state.measure("read raw textures sequentially", 5, [&] {
+        ns::RawTexture raw;
+        for (const auto& file : files)
+            raw.loadFromFile(file + ns::RawTexture::Extension);
+        ns::bench::doNotOptimize(raw.getPixels());
+    });
+    state.measure("load raw textures with autoload" + upload, 5, [&] {
+        ns::Res::load(assets, true);
+    });
+    const auto raw_pack = assets + "_raw" + ns::Pack::Extension;
+    ns::Pack::build(assets, raw_pack, false);
+    state.measure("load raw textures pack with autoload" + upload, 5, [&] {
+        ns::Res::load(raw_pack, true);
+    });
+}
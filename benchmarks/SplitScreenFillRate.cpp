@@ -0,0 +1,105 @@
+#include <iostream>
+#include <memory>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <NasNas/core/data/Config.hpp>
+
+#include "Benchmark.hpp"
+
+namespace {
+    // waits for the GPU by reading back a single pixel of the target
+    void finish(sf::RenderTexture& target, sf::RenderTexture& sync) {
+        target.display();
+        sf::Sprite pixel(target.getTexture(), {0, 0, 1, 1});
+        sync.draw(pixel);
+        sync.display();
+        ns::bench::doNotOptimize(sync.getTexture().copyToImage().getPixel(0, 0));
+    }
+}
+
+/**
+ * Compares the two ways a Camera can draw its Scene in split screen layouts, on a 1280x720 target :
+ * - offscreen : scene drawn in each camera texture, camera textures drawn in the App renderer,
+ *               and the renderer drawn on the final target (what a Camera with a shader does)
+ * - direct : scene drawn on the final target with a viewport per camera
+ *
+ * Requires an OpenGL context, only run with --gpu, and skipped when none can be created.
+ */
+NS_BENCHMARK(SplitScreenFillRate) {
+    if (ns::Settings::getConfig().headless) {
+        std::cout << "    SplitScreenFillRate skipped, run with --gpu to draw on the GPU" << std::endl;
+        return;
+    }
+    const sf::Vector2u size = {1280, 720};
+    sf::RenderTexture target, renderer, sync;
+    if (!target.create(size.x, size.y) || !renderer.create(size.x, size.y) || !sync.create(1, 1)) {
+        std::cout << "    SplitScreenFillRate skipped, could not create an OpenGL context" << std::endl;
+        return;
+    }
+
+    sf::Image image;
+    image.create(16, 16, sf::Color(200, 120, 40));
+    sf::Texture texture;
+    texture.loadFromImage(image);
+
+    // a tiled background of 16x16 quads covering the scene, each pixel is filled once per pass
+    sf::VertexArray scene(sf::Triangles);
+    for (unsigned y = 0; y < size.y; y += 16) {
+        for (unsigned x = 0; x < size.x; x += 16) {
+            auto px = float(x), py = float(y);
+            scene.append({{px, py}, {0, 0}}); scene.append({{px+16, py}, {16, 0}}); scene.append({{px, py+16}, {0, 16}});
+            scene.append({{px, py+16}, {0, 16}}); scene.append({{px+16, py}, {16, 0}}); scene.append({{px+16, py+16}, {16, 16}});
+        }
+    }
+    sf::RenderStates states(&texture);
+
+    for (unsigned cameras : {1u, 2u, 4u}) {
+        // cameras are laid out in columns, each one looking at a part of the scene at scale 1
+        std::vector<sf::View> views;
+        std::vector<std::unique_ptr<sf::RenderTexture>> textures;
+        for (unsigned i = 0; i < cameras; ++i) {
+            auto width = float(size.x) / float(cameras);
+            sf::View view({float(i)*width, 0.f, width, float(size.y)});
+            view.setViewport({float(i)/float(cameras), 0.f, 1.f/float(cameras), 1.f});
+            views.push_back(view);
+            textures.push_back(std::make_unique<sf::RenderTexture>());
+            textures.back()->create(unsigned(width), size.y);
+        }
+
+        state.measure("offscreen, " + std::to_string(cameras) + " cameras", 200, [&] {
+            renderer.clear(sf::Color::Transparent);
+            for (unsigned i = 0; i < cameras; ++i) {
+                auto& texture_target = *textures[i];
+                auto view = views[i];
+                view.setViewport({0.f, 0.f, 1.f, 1.f});
+                texture_target.setView(view);
+                texture_target.clear(sf::Color::Transparent);
+                texture_target.draw(scene, states);
+                texture_target.display();
+                sf::Sprite sprite(texture_target.getTexture());
+                sprite.setPosition(views[i].getViewport().left*float(size.x), 0.f);
+                renderer.draw(sprite);
+            }
+            renderer.display();
+            target.clear();
+            target.draw(sf::Sprite(renderer.getTexture()));
+            finish(target, sync);
+        });
+
+        state.measure("direct, " + std::to_string(cameras) + " cameras", 200, [&] {
+            target.clear();
+            for (unsigned i = 0; i < cameras; ++i) {
+                target.setView(views[i]);
+                target.draw(scene, states);
+            }
+            target.setView(target.getDefaultView());
+            finish(target, sync);
+        });
+    }
+}
@@ -0,0 +1,53 @@
+#include <SFML/Graphics/Texture.hpp>
+
+#include <NasNas/core/data/Pools.hpp>
+#include <NasNas/core/data/Random.hpp>
+#include <NasNas/core/graphics/Sprite.hpp>
+#include <NasNas/core/graphics/SpriteBatch.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Generates the vertices of SpriteBatches with SpriteBatch::render :
+ * - persistent sprites drawn once and rendered each frame (Stream usage)
+ * - transient sprites drawn from a texture rect each frame, their memory is allocated
+ *   during the first frame and reused by the next ones
+ *
+ * The texture is never loaded, in headless mode only the vertices are generated.
+ */
+NS_BENCHMARK(SpriteBatch) {
+    sf::Texture texture;
+    ns::utils::Random random(11);
+
+    for (std::size_t count : {1000u, 10000u, 100000u}) {
+        std::vector<ns::Sprite> sprites;
+        sprites.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto& sprite = sprites.emplace_back(texture, sf::IntRect(0, 0, 16, 16));
+            sprite.setPosition(random.uniform(0.f, 4000.f), random.uniform(0.f, 4000.f));
+            sprite.setRotation(random.uniform(0.f, 360.f));
+        }
+
+        ns::SpriteBatch batch;
+        for (const auto& sprite : sprites)
+            batch.draw(&sprite);
+        batch.end();
+        state.measure("render, " + std::to_string(count) + " sprites", count >= 100000 ? 20 : 100, [&] {
+            batch.render();
+            ns::bench::doNotOptimize(batch.getGlobalBounds());
+        });
+
+        // immediate mode, the transient sprites of the previous frame are replaced without clearing the batch
+        ns::SpriteBatch transient_batch;
+        const auto allocations = ns::Allocations::getTotalStats().allocations;
+        std::size_t frames = 0;
+        state.measure("draw transient and render, " + std::to_string(count) + " sprites", count >= 100000 ? 10 : 50, [&] {
+            for (const auto& sprite : sprites)
+                transient_batch.draw(&texture, sprite.getPosition(), sf::IntRect(0, 0, 16, 16));
+            transient_batch.render();
+            ns::bench::doNotOptimize(transient_batch.getGlobalBounds());
+            frames++;
+        });
+        state.counter("heap allocations per frame", double(ns::Allocations::getTotalStats().allocations - allocations) / double(frames));
+    }
+}
@@ -0,0 +1,58 @@
+#include <sstream>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <NasNas/core/data/Random.hpp>
+#include <NasNas/reslib/ResourceManager.hpp>
+#include <NasNas/Tilemapping.hpp>
+
+#include "Benchmark.hpp"
+
+namespace {
+    // orthogonal map with an embedded 16x16 tileset, one animated tile, and random csv layers
+    auto generateTmx(unsigned size, unsigned layers) -> std::string {
+        ns::utils::Random random(5);
+        std::ostringstream tmx;
+        tmx << R"(<?xml version="1.0" encoding="UTF-8"?>)" << '\n'
+            << R"(<map version="1.5" orientation="orthogonal" renderorder="right-down" width=")" << size
+            << R"(" height=")" << size << R"(" tilewidth="16" tileheight="16" infinite="0">)" << '\n'
+            << R"( <tileset firstgid="1" name="tiles" tilewidth="16" tileheight="16" tilecount="256" columns="16">)" << '\n'
+            << R"(  <image source="tiles.png" width="256" height="256"/>)" << '\n'
+            << R"(  <tile id="0"><animation><frame tileid="0" duration="100"/><frame tileid="1" duration="100"/></animation></tile>)" << '\n'
+            << R"( </tileset>)" << '\n';
+        for (unsigned l = 0; l < layers; ++l) {
+            tmx << R"( <layer id=")" << l+1 << R"(" name="layer)" << l << R"(" width=")" << size << R"(" height=")" << size << R"(">)" << '\n'
+                << R"(  <data encoding="csv">)" << '\n';
+            for (unsigned i = 0; i < size*size; ++i) {
+                // a third of the cells are empty
+                auto gid = random.next() % 3 == 0 ? 0u : 1 + random.next() % 256;
+                tmx << gid << (i+1 < size*size ? "," : "") << ((i+1) % size == 0 ? "\n" : "");
+            }
+            tmx << R"(  </data>)" << '\n' << R"( </layer>)" << '\n';
+        }
+        tmx << "</map>\n";
+        return tmx.str();
+    }
+}
+
+/**
+ * Parses TMX maps and builds their TileLayers (tiles and vertices) with TiledMap::loadFromString.
+ * The tileset texture is loaded through the ResourceManager, it stays empty in headless mode.
+ */
+NS_BENCHMARK(TileLayer) {
+    auto assets = ns::bench::makeTemporaryDirectory("nasnas_bench_tilelayer");
+    sf::Image tileset;
+    tileset.create(256, 256, sf::Color::White);
+    tileset.saveToFile(assets + "/tiles.png");
+    ns::Res::load(assets, false);
+
+    for (unsigned size : {64u, 256u}) {
+        const auto tmx = generateTmx(size, 3);
+        state.measure("loadFromString " + std::to_string(size) + "x" + std::to_string(size) + ", 3 layers", size >= 256 ? 5 : 20, [&] {
+            ns::tm::TiledMap map;
+            map.loadFromString(tmx);
+            ns::bench::doNotOptimize(map.getSize());
+        });
+        state.counter("tiles", double(size*size*3));
+    }
+}
@@ -0,0 +1,57 @@
+#include <NasNas/core/data/TimeSource.hpp>
+#include <NasNas/tween/Easing.hpp>
+#include <NasNas/tween/Tween.hpp>
+#include <NasNas/tween/TweenManager.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * Steps looping Tweens each writing their value in an array through their callback,
+ * as UI animations and moving platforms do each update. The default TimeSource is advanced
+ * by 1/60s before each step, as App::step does.
+ *
+ * The same number of looping tweens is then advanced by a TweenManager, writing to their target
+ * directly, and through step callbacks.
+ */
+NS_BENCHMARK(Tween) {
+    for (std::size_t count : {1000u, 10000u, 100000u}) {
+        // the tweens of each case start at time 0
+        ns::TimeSource::getDefault().reset();
+        std::vector<float> values(count, 0.f);
+        std::vector<ns::Tween> tweens(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            tweens[i].loop()
+                .from_to(0.f, 100.f).during(0.5f + float(i % 10) * 0.1f).with(ns::easing::quadraticInOut)
+                .apply([&values, i](float v) { values[i] = v; })
+                .to(0.f).during(0.5f).with(ns::easing::sinusoidalOut)
+                .apply([&values, i](float v) { values[i] = v; });
+        }
+
+        state.measure("step, " + std::to_string(count) + " tweens", count >= 100000 ? 20 : 100, [&] {
+            ns::TimeSource::getDefault().advance(1.f / 60.f);
+            for (auto& tween : tweens)
+                tween.step();
+            ns::bench::doNotOptimize(values.data());
+        });
+
+        ns::TweenManager targets_manager;
+        ns::TweenManager callbacks_manager;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto easing = i % 2 ? ns::tween::EasingType::QuadraticInOut : ns::tween::EasingType::SinusoidalOut;
+            auto id = targets_manager.add(&values[i], 0.f, 100.f, 0.5f + float(i % 10) * 0.1f, easing);
+            targets_manager.setLoop(id, true);
+            id = callbacks_manager.add(0.f, 100.f, 0.5f + float(i % 10) * 0.1f, easing);
+            callbacks_manager.setLoop(id, true);
+            callbacks_manager.onStep(id, [&values, i](float v) { values[i] = v; });
+        }
+
+        state.measure("TweenManager update targets, " + std::to_string(count) + " tweens", count >= 100000 ? 20 : 100, [&] {
+            targets_manager.update(1.f / 60.f);
+            ns::bench::doNotOptimize(values.data());
+        });
+        state.measure("TweenManager update callbacks, " + std::to_string(count) + " tweens", count >= 100000 ? 20 : 100, [&] {
+            callbacks_manager.update(1.f / 60.f);
+            ns::bench::doNotOptimize(values.data());
+        });
+    }
+}
@@ -0,0 +1,159 @@
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <NasNas/core/data/Config.hpp>
+
+#include "Benchmark.hpp"
+
+using namespace ns::bench;
+
+State::State(std::string benchmark) : m_benchmark(std::move(benchmark))
+{}
+
+void State::counter(const std::string& name, double value) {
+    if (m_results.empty()) {
+        std::cerr << "Warning : counter " << name << " reported before any measure in " << m_benchmark << std::endl;
+        return;
+    }
+    m_results.back().counters.emplace_back(name, value);
+}
+
+auto State::getResults() const -> const std::vector<Result>& {
+    return m_results;
+}
+
+auto ns::bench::getBenchmarks() -> std::vector<std::pair<std::string, Function>>& {
+    static std::vector<std::pair<std::string, Function>> benchmarks;
+    return benchmarks;
+}
+
+auto ns::bench::makeTemporaryDirectory(const std::string& name) -> std::string {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path.string();
+}
+
+Registration::Registration(const char* name, Function fn) {
+    getBenchmarks().emplace_back(name, fn);
+}
+
+namespace {
+    auto escape(const std::string& str) -> std::string {
+        std::string result;
+        for (auto c : str) {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    auto compiler() -> std::string {
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    /**
+     * Writes the results in a JSON file, with enough context to compare two runs :
+     * { "context": {...}, "benchmarks": [ {"benchmark", "name", "iterations", "mean_us", "min_us", "max_us", "counters": {...}}, ... ] }
+     */
+    auto writeJson(const std::string& path, const std::vector<Result>& results, bool headless) -> bool {
+        std::ofstream file(path);
+        if (!file) {
+            std::cerr << "Error : could not open " << path << " to write the benchmarks results." << std::endl;
+            return false;
+        }
+        char date[32];
+        auto now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        file << "{\n";
+        file << "  \"context\": {\n";
+        file << "    \"date\": \"" << date << "\",\n";
+        file << "    \"compiler\": \"" << escape(compiler()) << "\",\n";
+#ifdef NDEBUG
+        file << "    \"build_type\": \"release\",\n";
+#else
+        file << "    \"build_type\": \"debug\",\n";
+#endif
+        file << "    \"threads\": " << std::thread::hardware_concurrency() << ",\n";
+        file << "    \"headless\": " << (headless ? "true" : "false") << "\n";
+        file << "  },\n";
+        file << "  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            file << (i == 0 ? "\n" : ",\n");
+            file << "    {\"benchmark\": \"" << escape(r.benchmark) << "\", \"name\": \"" << escape(r.name) << "\", "
+                 << "\"iterations\": " << r.iterations << ", "
+                 << "\"mean_us\": " << r.mean_us << ", \"min_us\": " << r.min_us << ", \"max_us\": " << r.max_us << ", "
+                 << "\"counters\": {";
+            for (std::size_t j = 0; j < r.counters.size(); ++j)
+                file << (j == 0 ? "" : ", ") << "\"" << escape(r.counters[j].first) << "\": " << r.counters[j].second;
+            file << "}}";
+        }
+        file << "\n  ]\n}\n";
+        return file.good();
+    }
+}
+
+/**
+ * Runs all the registered benchmarks, or only the ones whose name contains
+ * the filter string. The benchmarks run headless, without OpenGL context,
+ * unless --gpu is given to also run the ones drawing on the GPU.
+ *
+ *   NasNas_benchmarks [filter] [--json <file>] [--gpu]
+ */
+int main(int argc, char** argv) {
+    std::string filter, json_path;
+    bool gpu = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i+1 < argc)
+            json_path = argv[++i];
+        else if (arg == "--gpu")
+            gpu = true;
+        else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "Usage : NasNas_benchmarks [filter] [--json <file>] [--gpu]" << std::endl;
+            return -1;
+        }
+        else
+            filter = arg;
+    }
+
+    ns::AppConfig config;
+    config.headless = !gpu;
+    ns::Settings::setConfig(config);
+
+    std::vector<Result> results;
+    std::printf("%-24s %-36s %10s %12s %12s %12s\n", "benchmark", "case", "iterations", "mean (us)", "min (us)", "max (us)");
+    for (const auto& [name, fn] : getBenchmarks()) {
+        if (name.find(filter) == std::string::npos)
+            continue;
+        State state(name);
+        fn(state);
+        for (const auto& r : state.getResults()) {
+            std::printf("%-24s %-36s %10zu %12.2f %12.2f %12.2f\n", r.benchmark.c_str(), r.name.c_str(), r.iterations, r.mean_us, r.min_us, r.max_us);
+            for (const auto& [counter, value] : r.counters)
+                std::printf("    %s : %g\n", counter.c_str(), value);
+            results.push_back(r);
+        }
+        std::fflush(stdout);
+    }
+
+    if (!json_path.empty() && !writeJson(json_path, results, !gpu))
+        return -1;
+    return 0;
+}
@@ -131,6 +131,9 @@ macro(check_compiler)
     if (ANDROID)
         set(NasNas_Libs "${NasNas_Libs};android;log")
     endif()
+    # worker threads used by the ThreadPool
+    find_package(Threads REQUIRED)
+    set(NasNas_Libs "${NasNas_Libs};Threads::Threads")
 endmacro()
 
 # Adds a target to the global NASNAS_${type}_TARGETS global property
@@ -28,6 +28,7 @@ public:
 
 class Game : public ns::App {
     MyCustomParticleSystem m_particles_system;
+    ns::ParticleSystem m_smoke_system;
 public:
     Game() : ns::App("Particles System example", {1280, 720}) {
         // create a scene and a camera
@@ -41,6 +42,16 @@ public:
         m_particles_system.emit({240, 16, 16, 16}, 50, true);
         scene.getDefaultLayer().addRaw(&m_particles_system);
 
+        // particles driven by an emitter description loaded from a file
+        ns::ParticleEmitter smoke;
+        smoke.loadFromFile("assets/smoke.particles");
+        m_smoke_system.setEmitter(smoke);
+        m_smoke_system.setEmitRate(30.f);
+        m_smoke_system.setTexture(ns::Res::getTexture("tileset.png"));
+        m_smoke_system.setPosition(800, 500);
+        m_smoke_system.emit({240, 16, 16, 16}, 100, true);
+        scene.getDefaultLayer().addRaw(&m_smoke_system);
+
         addDebugText<unsigned>("Particles count :", [&]{return m_particles_system.getParticleCount();}, {0, 0});
     }
 
@@ -60,11 +71,12 @@ public:
     void update() override {
         m_particles_system.setPosition(getMousePosition(getCamera("main")));
         m_particles_system.update();
+        m_smoke_system.update();
     }
 };
 
 int main() {
-    srand(time(nullptr));
+    ns::utils::setRandomSeed(time(nullptr));
 
     ns::Res::load("assets");
 
@@ -54,6 +54,8 @@ Game::Game() : ns::App("NasNas sandbox", {640, 360}, 2, 60, 60) {
     //------------ Scene and Layers creation --------------------------------------------
     auto& scene = this->createScene("main");            // create a scene
     scene.createLayers("shapes", "entities", "texts");  // create 3 layers
+    // shapes move a little each frame, only sort the ones that are out of order
+    scene.getLayer("shapes").setYSortMode(ns::Layer::YSortMode::Incremental);
     //-----------------------------------------------------------------------------------
 
     //------------ Camera creation ------------------------------------------------------
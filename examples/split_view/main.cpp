@@ -43,6 +43,10 @@ public:
         auto& camera_right = createCamera("right", 0, {0, 0, window_size.x/2, window_size.y}, {0.501f, 0, 0.499f, 1});
         camera_right.lookAt(scene);
 
+        // the scene never changes, cameras only need to draw it again when they move
+        camera_left.setRefreshPolicy(ns::Camera::RefreshPolicy::OnDirty);
+        camera_right.setRefreshPolicy(ns::Camera::RefreshPolicy::OnDirty);
+
         addDebugText("Press WASD to move left camera or arrow keys to move right camera.", {50, 10});
     }
 
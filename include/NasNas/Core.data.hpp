@@ -4,8 +4,15 @@
 
 #include <NasNas/core/data/Arial.hpp>
 #include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/FileWatcher.hpp>
+#include <NasNas/core/data/FrameBuffers.hpp>
 #include <NasNas/core/data/Logger.hpp>
 #include <NasNas/core/data/Maths.hpp>
+#include <NasNas/core/data/Pools.hpp>
+#include <NasNas/core/data/Random.hpp>
 #include <NasNas/core/data/Rect.hpp>
 #include <NasNas/core/data/ShaderHolder.hpp>
+#include <NasNas/core/data/SpatialGrid.hpp>
+#include <NasNas/core/data/ThreadPool.hpp>
+#include <NasNas/core/data/TimeSource.hpp>
 #include <NasNas/core/data/Utils.hpp>
@@ -5,8 +5,10 @@
 #include <NasNas/core/graphics/Anim.hpp>
 #include <NasNas/core/graphics/BitmapText.hpp>
 #include <NasNas/core/graphics/BitmapFont.hpp>
+#include <NasNas/core/graphics/ParticleEmitter.hpp>
 #include <NasNas/core/graphics/ParticleSystem.hpp>
 #include <NasNas/core/graphics/Renderable.hpp>
+#include <NasNas/core/graphics/RenderQueue.hpp>
 #include <NasNas/core/graphics/Shapes.hpp>
 #include <NasNas/core/graphics/Sprite.hpp>
 #include <NasNas/core/graphics/SpriteBatch.hpp>
@@ -18,4 +18,5 @@
 #include <NasNas/core/Layer.hpp>
 #include <NasNas/core/Scene.hpp>
 #include <NasNas/core/Transition.hpp>
+#include <NasNas/core/UpdateScheduler.hpp>
 #include <NasNas/core/Window.hpp>
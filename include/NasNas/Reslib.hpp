@@ -2,4 +2,9 @@
 
 #pragma once
 
+#include <NasNas/reslib/LoadingTask.hpp>
+#include <NasNas/reslib/Pack.hpp>
+#include <NasNas/reslib/RawTexture.hpp>
+#include <NasNas/reslib/ResourceHandle.hpp>
+#include <NasNas/reslib/ResourceIndex.hpp>
 #include <NasNas/reslib/ResourceManager.hpp>
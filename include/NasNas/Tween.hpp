@@ -3,5 +3,7 @@
 #pragma once
 
 #include <NasNas/tween/Easing.hpp>
+#include <NasNas/tween/EasingTable.hpp>
 #include <NasNas/tween/Tween.hpp>
+#include <NasNas/tween/TweenManager.hpp>
 #include <NasNas/tween/MultiTween.hpp>
@@ -10,8 +10,10 @@
 #include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <stack>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -22,14 +24,18 @@
 #include <SFML/Window/Event.hpp>
 
 #include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/FrameBuffers.hpp>
+#include <NasNas/core/data/Pools.hpp>
 #include <NasNas/core/data/Rect.hpp>
 #include <NasNas/core/data/ShaderHolder.hpp>
 
 #include <NasNas/core/AppState.hpp>
 #include <NasNas/core/Camera.hpp>
 #include <NasNas/core/Debug.hpp>
+#include <NasNas/core/graphics/RenderQueue.hpp>
 #include <NasNas/core/Scene.hpp>
 #include <NasNas/core/Transition.hpp>
+#include <NasNas/core/UpdateScheduler.hpp>
 #include <NasNas/core/Window.hpp>
 
 namespace ns {
@@ -130,8 +136,56 @@ namespace ns {
 
         auto getDt() const -> float;
 
+        /**
+         * \brief Get the scheduler deciding how many updates run each frame
+         *
+         * Use it to set the catch up limit, enable the dynamic update rate or read the update counters.
+         *
+         * \return Reference to the UpdateScheduler
+         */
+        auto getUpdateScheduler() -> UpdateScheduler&;
+
+        /**
+         * \brief Get the fraction of the next update already elapsed, to be used when rendering
+         *
+         * Updates run at a fixed rate, so frames are rendered between two updates. Blending the
+         * previous and current states of an object with this factor gives a smooth movement
+         * even when the App renders more frames than it updates.
+         * Cameras, Layers (see Layer::setInterpolation) and ECS Transform components can do it automatically.
+         * Always 1 when rendering on a dedicated thread, frames are captured right after the updates.
+         *
+         * \return Interpolation factor, between 0 (previous update) and 1 (current update)
+         */
+        auto getInterpolation() const -> float;
+
+        /**
+         * \brief Stops the game loop, closes the window if there is one
+         */
+        void quit();
+
+        /**
+         * \brief Is the App running without window (see AppConfig::headless) ?
+         *
+         * \return True if the App is headless
+         */
+        auto isHeadless() const -> bool;
+
         /**
          * \brief Starts the game loop.
+         *
+         * In headless mode, the loop runs until `quit` is called. Updates run as fast as possible,
+         * each frame advancing the simulation by one update, or in real time with `headless_realtime`.
+         * Nothing is drawn. When `headless_vertex_pass` is enabled, the visible drawables of each Camera
+         * are culled and the vertices of the batchable ones are generated on the CPU.
+         * Textures and render textures can not be used : no OpenGL context is created.
+         *
+         * When `render_thread` is enabled in the config, frames are drawn on a dedicated thread.
+         * At the end of each update, the Cameras views and the triangles of the batchable drawables
+         * (ns::Sprite, ns::BitmapText, ns::ui::NineSlice) are copied in a frame snapshot,
+         * that the render thread draws while the next frame is updated.
+         * Other drawables, Renderables, transitions and debug texts are still read when drawing,
+         * so the render thread waits for the update to finish when a frame contains some of them.
+         * Cameras must not be reset and shader uniforms should be set in `preRender` while running.
          */
         void run();
 
@@ -212,6 +266,8 @@ namespace ns {
         /**
          * \brief The App enters sleep mode, the App will not update.
          * Used for Android when application runs in background
+         *
+         * The default TimeSource is not advanced either, the animations are paused.
          */
         void sleep();
 
@@ -248,7 +304,10 @@ namespace ns {
         int m_fps;              ///< Frame per second
         sf::Clock m_fps_clock;  ///< Clock to compute real FPS
         float m_dt;             ///< Delta time, time between two frames
+        float m_alpha = 1.f;    ///< Interpolation factor between the two last updates
+        UpdateScheduler m_scheduler;
         bool m_sleeping = false;
+        bool m_quit = false;
 
         std::list<Camera> m_cameras;
         std::list<Scene> m_scenes;
@@ -256,6 +315,37 @@ namespace ns {
         std::vector<std::unique_ptr<DebugTextInterface>> m_debug_texts;
         std::vector<sf::Vertex> m_debug_bounds;
 
+        /**
+         * \brief Everything the render thread needs to draw a Camera
+         */
+        struct CameraFrame {
+            Camera* camera = nullptr;
+            sf::View view;          ///< Camera view when the frame was captured
+            bool direct = false;
+            bool refresh = false;
+            sf::Sprite sprite;      ///< Camera sprite when the frame was captured, the update thread can move it
+            RenderQueue queue;      ///< Captured Scene content, empty if the Camera is not refreshed
+        };
+
+        /**
+         * \brief Snapshot of a frame, written by the update thread and read by the render thread
+         */
+        struct Frame {
+            std::vector<CameraFrame> cameras;
+            std::size_t cameras_count = 0;  ///< Number of used CameraFrames, the others are kept for reuse
+            sf::View app_view;
+            sf::View screen_view;
+            sf::Color clear_color;
+            bool direct = false;
+            bool live = false;      ///< True if drawing the frame reads the App state, or a shader the update thread sets uniforms on
+            bool consumed = true;   ///< False until the render thread drew the frame
+        };
+
+        std::unique_ptr<FrameBuffers<Frame>> m_frames;
+        std::thread m_render_thread;
+        std::mutex m_state_mutex;   ///< Held by the update thread, and by the render thread while drawing live content
+        bool m_fullscreen_requested = false;    ///< The window is recreated once the render thread is stopped
+
         std::function<void(const sf::Event&)> m_cb_onevent=[](const sf::Event&){};
         std::function<void()> m_cb_update=[]{};
         std::function<void()> m_cb_prerender=[]{};
@@ -269,11 +359,53 @@ namespace ns {
          */
         static void storeInputs(const sf::Event& event);
 
+        /**
+         * \brief Stores the state of the interpolated Cameras and Layers before an update
+         */
+        void savePreviousState();
+
+        /**
+         * \brief Runs one fixed update of the App, its Cameras and its transitions
+         */
+        void step();
+
+        void runHeadless();
+
+        /**
+         * \brief Culls the Scenes and generates their vertices without drawing them, used in headless mode
+         */
+        void renderVertices();
+
         /**
          * \brief Render App content to the AppWindow
          */
         void render();
 
+        void renderTransitions(sf::RenderTarget& target);
+        void renderDebug();
+
+        void startRenderThread();
+        void stopRenderThread();
+
+        /**
+         * \brief Copies the content of the next frame in a frame buffer, called by the update thread
+         */
+        void captureFrame();
+
+        /**
+         * \brief Draws a captured frame and displays it, called by the render thread
+         *
+         * \param frame Frame to draw
+         */
+        void renderFrame(Frame& frame);
+
+        /**
+         * \brief Checks if the App content can be drawn directly on the AppWindow, without m_renderer
+         *
+         * \return True if there is no App shader and the AppWindow scale is an integer
+         */
+        auto canRenderDirectly() const -> bool;
+
         void renderDebugBounds();
         void storeDrawableDebugRects(const ns::FloatRect& drawable_bounds, Camera& cam,
                                      const sf::FloatRect& render_bounds, sf::Vector2f& offset,
@@ -284,6 +416,7 @@ namespace ns {
     template <typename T, typename... Targs,  typename Enable>
     auto App::startTransition(Targs&&... args) -> Transition& {
         auto new_transition = std::make_unique<T>(std::forward<Targs>(args)...);
+        Allocations::record(1, 1, sizeof(T));
         new_transition->start();
         m_transitions.push_back(std::move(new_transition));
         return *m_transitions.back();
@@ -292,6 +425,7 @@ namespace ns {
     template<typename T>
     void App::addDebugText(const std::string& label, T* var_address, const sf::Vector2f& position, const sf::Color& color) {
         auto* dbg_txt = new DebugText<T>(label, var_address, position);
+        Allocations::record(1, 1, sizeof(DebugText<T>));
         dbg_txt->setFillColor(color);
         m_debug_texts.emplace_back(dbg_txt);
     }
@@ -299,6 +433,7 @@ namespace ns {
     template<typename T>
     void App::addDebugText(const std::string& label, std::function<T()> fn, const sf::Vector2f& position, const sf::Color& color) {
         auto* dbg_txt = new DebugText<T>(label, fn, position);
+        Allocations::record(1, 1, sizeof(DebugText<T>));
         dbg_txt->setFillColor(color);
         m_debug_texts.emplace_back(dbg_txt);
     }
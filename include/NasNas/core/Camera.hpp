@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 
@@ -22,6 +24,16 @@ namespace ns {
     class Camera : public sf::View, public ShaderHolder {
         friend class App;
     public:
+        /**
+         * \brief How often the Camera draws its Scene again
+         *
+         * - EveryFrame : the Scene is drawn every frame (default)
+         * - EveryNFrames : the Scene is drawn once every N frames, the last image is reused in between
+         * - OnDirty : the Scene is drawn only when the Camera moved, when the Scene or its Layers
+         *   changed (see Layer::markDirty), or when `markDirty` is called
+         */
+        enum class RefreshPolicy {EveryFrame, EveryNFrames, OnDirty};
+
         /**
          * \brief Construct a Camera object
          *
@@ -240,6 +252,45 @@ namespace ns {
          */
         void update();
 
+        /**
+         * \brief Set how often the Camera draws its Scene
+         *
+         * Cameras that are not refreshed every frame keep their content in their render texture,
+         * useful for minimaps, HUD or any Camera whose content rarely changes.
+         *
+         * \param policy Refresh policy
+         * \param frames Number of frames between two refreshes, used by EveryNFrames
+         */
+        void setRefreshPolicy(RefreshPolicy policy, unsigned int frames=1);
+
+        auto getRefreshPolicy() const -> RefreshPolicy;
+
+        /**
+         * \brief Forces the Camera to draw its Scene again on the next render
+         */
+        void markDirty();
+
+        /**
+         * \brief Draws the Scene from a position between the previous update and the current one
+         *
+         * Smooths the Camera movements when the App renders more frames than it updates,
+         * see App::getInterpolation. The Camera is displayed up to one update late.
+         *
+         * \param value True to enable interpolation
+         */
+        void setInterpolation(bool value);
+
+        auto hasInterpolation() const -> bool;
+
+        /**
+         * \brief Get the view the Camera is drawn with
+         *
+         * \param alpha Interpolation factor between the previous update (0) and the current one (1)
+         *
+         * \return Camera view, with an interpolated center if interpolation is enabled
+         */
+        auto getInterpolatedView(float alpha) const -> sf::View;
+
     private:
         std::string m_name;                 ///< Camera name
         int m_render_order;                 ///< Camera render order
@@ -256,11 +307,82 @@ namespace ns {
         std::unique_ptr<sf::RenderTexture> m_render_texture;///< Render texture where the view will be drawn
         sf::Sprite m_sprite;                ///< Sprite containing the render_texture's texture
 
+        RefreshPolicy m_refresh_policy = RefreshPolicy::EveryFrame;
+        unsigned int m_refresh_frames = 1;  ///< Frames between two refreshes with EveryNFrames
+        unsigned int m_frames_since_refresh = 0;
+        bool m_dirty = true;                ///< True if the render texture content is outdated
+        const Scene* m_rendered_scene = nullptr;    ///< State of the last refresh, used by OnDirty
+        std::uint64_t m_rendered_version = 0;
+        sf::Vector2f m_rendered_center;
+        sf::Vector2f m_rendered_size;
+        float m_rendered_rotation = 0.f;
+        bool m_interpolation = false;
+        sf::Vector2f m_previous_center;     ///< Center before the last update, used by interpolation
+
         /**
          * \brief Renders Camera content on the given target
+         *
+         * The Scene is drawn on the Camera render texture first only if needed, that is
+         * when the Camera has a shader or when its content is not scaled by an integer factor.
+         * Otherwise, the Scene is drawn directly on the target with an adjusted viewport.
+         *
          * \param target Target where content is drawn on, usualy the AppWindow
+         * \param alpha Interpolation factor, see App::getInterpolation
+         */
+        void render(sf::RenderTarget& target, float alpha);
+
+        /**
+         * \brief Renders Camera content on the given target, with a Scene drawing function
+         *
+         * Used by the render thread to draw a Scene captured by the update thread.
+         *
+         * \param target Target where content is drawn on
+         * \param view View the Scene is drawn with
+         * \param direct True to draw the Scene directly on the target
+         * \param refresh True to draw the Scene again on the render texture, ignored if direct is true
+         * \param sprite Sprite of the render texture, copied when the frame was captured
+         * \param draw_scene Function drawing the Scene on a target
+         */
+        void render(sf::RenderTarget& target, const sf::View& view, bool direct, bool refresh, const sf::Sprite& sprite,
+                    const std::function<void(sf::RenderTarget&)>& draw_scene);
+
+        /**
+         * \brief Checks if the Camera content can be drawn directly on a target
+         *
+         * \param target_size Size of the target in pixels
+         * \param target_vport Viewport of the target view
+         *
+         * \return True if the offscreen pass is not needed
+         */
+        auto canRenderDirectly(const sf::Vector2u& target_size, const sf::FloatRect& target_vport) const -> bool;
+
+        /**
+         * \brief Decides if the render texture is drawn again this frame, and records the state it is drawn with
+         *
+         * \param view View the Scene would be drawn with
+         *
+         * \return True if the render texture has to be refreshed
+         */
+        auto beginRefresh(const sf::View& view) -> bool;
+
+        /**
+         * \brief Stores the current center as the previous one, called by the App before each update
+         */
+        void savePreviousState();
+
+        /**
+         * \brief Places the sprite displaying the render texture according to the viewport
+         */
+        void updateSprite();
+
+        /**
+         * \brief Checks if the render texture has to be drawn again, according to the refresh policy
+         *
+         * \param view View the Scene would be drawn with
+         *
+         * \return True if the content is outdated
          */
-        void render(sf::RenderTarget& target);
+        auto needsRefresh(const sf::View& view) const -> bool;
 
         auto getSprite() const -> const sf::Sprite&;
 
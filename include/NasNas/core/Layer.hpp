@@ -5,13 +5,15 @@
 
 #pragma once
 
-#include <functional>
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <SFML/Graphics/Drawable.hpp>
@@ -19,12 +21,25 @@
 #include <SFML/System/Vector2.hpp>
 
 #include <NasNas/core/data/Introspection.hpp>
+#include <NasNas/core/data/Pools.hpp>
+#include <NasNas/core/data/SpatialGrid.hpp>
 
 namespace ns {
     class Scene;
 
     class Layer {
+        friend Scene;
     public:
+        /**
+         * \brief Algorithm used by `ySort`
+         *
+         * - Full sorts all the drawables each time
+         * - Incremental only moves the drawables that are out of order since the previous sort,
+         *   which is much faster when few drawables move between two sorts. It falls back
+         *   to a full sort when too many drawables moved.
+         */
+        enum class YSortMode {Full, Incremental};
+
         /**
          * \brief Construct a Layer object
          *
@@ -90,9 +105,112 @@ namespace ns {
         /**
          * \brief Sorts Layer drawables by their Y coordinate
          *
-         * `ySort` can be used to perform Z ordring for top down games
+         * `ySort` can be used to perform Z ordring for top down games.
+         * The sort is stable, drawables with the same Y keep their relative order.
+         *
+         * \return Number of drawables that changed position in the drawing order
+         */
+        auto ySort() -> std::size_t;
+
+        /**
+         * \brief Set the algorithm used by `ySort`
+         *
+         * Use Incremental for layers sorted every frame where the drawables move a little
+         *
+         * \param mode Sort mode, Full by default
+         */
+        void setYSortMode(YSortMode mode);
+
+        auto getYSortMode() const -> YSortMode;
+
+        /**
+         * \brief Enables the spatial index of the Layer
+         *
+         * When the spatial index is enabled, the bounds of the drawables are cached
+         * in a grid so that only the drawables near the visible area are tested when drawing.
+         * This is useful for layers containing a lot of static drawables.
+         * When an indexed drawable moves or changes size, `updateBounds` has to be called.
+         *
+         * \param cell_size Size of the grid cells, should be close to the size of the drawables
+         */
+        void enableSpatialIndex(float cell_size=256.f);
+
+        /**
+         * \brief Disables the spatial index, drawables bounds are computed each time they are needed
+         */
+        void disableSpatialIndex();
+
+        auto hasSpatialIndex() const -> bool;
+
+        /**
+         * \brief Updates the cached bounds of a drawable, and its place in the spatial index
+         *
+         * If the bounds changed, the Layer is marked as modified.
+         *
+         * \param dr Drawable that moved or was resized
          */
-        void ySort();
+        void updateBounds(const sf::Drawable* dr);
+
+        /**
+         * \brief Updates the cached bounds of all the drawables, and the spatial index
+         */
+        void updateBounds();
+
+        /**
+         * \brief Marks the Layer as modified
+         *
+         * Cameras refreshed only when their content changes (see Camera::RefreshPolicy) detect
+         * drawables added, removed, sorted or whose bounds changed with `updateBounds`.
+         * Other changes to the drawables (color, texture, ...) have to be signaled with this method.
+         */
+        void markDirty();
+
+        /**
+         * \brief Get the modification counter of the Layer, incremented each time the Layer changes
+         *
+         * \return Layer version
+         */
+        auto getVersion() const -> std::uint64_t;
+
+        /**
+         * \brief Get the drawables intersecting an area, in drawing order
+         *
+         * \param area Area to test
+         * \param result Vector the intersecting drawables are appended to
+         */
+        void getDrawablesIn(const sf::FloatRect& area, std::vector<const sf::Drawable*>& result) const;
+
+        /**
+         * \brief Allows the Scene to reorder the drawables of this Layer by texture when drawing
+         *
+         * Drawables sharing a texture are then merged in a single draw call, even if
+         * other drawables are between them. Use it only for layers whose drawables do not overlap.
+         *
+         * \param value True to enable texture sorting
+         */
+        void setTextureSorting(bool value);
+
+        auto hasTextureSorting() const -> bool;
+
+        /**
+         * \brief Draws the drawables between their previous and current positions
+         *
+         * Smooths the movements when the App renders more frames than it updates, see App::getInterpolation.
+         * Only the position is interpolated, and the drawables are displayed up to one update late.
+         *
+         * \param value True to enable interpolation
+         */
+        void setInterpolation(bool value);
+
+        auto hasInterpolation() const -> bool;
+
+        /**
+         * \brief Stores the current position of the drawables as their previous position
+         *
+         * Called by the App before each update on interpolated Layers. Call it after
+         * teleporting drawables so that they are not drawn between their old and new positions.
+         */
+        void savePreviousState();
 
         /**
          * \brief Get the name of the Layer
@@ -102,36 +220,99 @@ namespace ns {
         auto getName() const -> const std::string&;
 
     private:
+        /**
+         * \brief Everything the Layer needs to know about one of its drawables
+         *
+         * The getters are plain function pointers created for the drawable type when it is added,
+         * so no allocation or hash lookup is needed to query a drawable.
+         */
+        struct Record {
+            const sf::Drawable* drawable;
+            const void* object;                                 ///< The drawable as its real type
+            auto (*position_getter)(const void*) -> sf::Vector2f;
+            auto (*bounds_getter)(const void*) -> sf::FloatRect;
+            auto (*texture_getter)(const void*) -> const sf::Texture*;         ///< Only for batchable drawables
+            void (*batch)(const void*, std::vector<sf::Vertex>&);               ///< Only for batchable drawables
+            sf::FloatRect bounds;                               ///< Cached by updateBounds
+            sf::Vector2f previous_position;                     ///< Saved by savePreviousState
+            float sort_key;                                     ///< Cached by ySort
+            std::uint32_t id;                                   ///< Stable index in m_indices
+            bool has_position;
+        };
+
+        /// Layers with more drawables than this are y-sorted with a radix sort
+        static constexpr std::size_t RadixSortThreshold = 256;
+
+        /// Incremental sorts giving up after more than this number of shifts per drawable
+        static constexpr std::size_t IncrementalSortMaxShifts = 4;
+
+        void addRecord(const Record& record);
+        auto removeRecord(const sf::Drawable* dr) -> bool;
+        auto findRecord(const sf::Drawable* dr) const -> const Record*;
+        void refreshBounds(Record& record);
+        void fullSort();
+        auto incrementalSort() -> bool;
+        auto applyOrder() -> std::size_t;
+
+        /**
+         * \brief Calls `fn` on the records of the drawables intersecting an area, in drawing order
+         */
+        template <typename F>
+        void forEachRecordIn(const sf::FloatRect& area, F&& fn) const;
+
         std::string m_name;
-        std::vector<const sf::Drawable*> m_drawables;
+        YSortMode m_ysort_mode = YSortMode::Full;
+        bool m_texture_sorting = false;
+        bool m_interpolation = false;
+        std::uint64_t m_version = 0;
+        std::vector<Record> m_records;                  ///< In drawing order
+        std::vector<const sf::Drawable*> m_drawables;   ///< Same order as m_records
         std::vector<std::unique_ptr<const sf::Drawable>> m_gc;
-        std::unordered_map<const sf::Drawable*, std::function<sf::Vector2f()>> m_position_getters;
-        std::unordered_map<const sf::Drawable*, std::function<sf::FloatRect()>> m_bounds_getters;
+        std::unordered_map<const sf::Drawable*, std::uint32_t> m_ids;
+        std::vector<std::uint32_t> m_indices;           ///< Index of each record in m_records, by id
+        std::vector<std::uint32_t> m_free_ids;
+        std::unique_ptr<SpatialGrid<std::uint32_t>> m_spatial_index;
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> m_sort_keys;   ///< Sort buffers reused between ySort calls
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> m_sort_tmp;
+        std::vector<Record> m_records_tmp;
+        mutable std::vector<std::uint32_t> m_query_indices;  ///< Reused by getDrawablesIn
     };
 
     template <typename T, typename>
     void Layer::add(const T& dr) {
-        static constexpr auto float_min = std::numeric_limits<float>::lowest();
-        static constexpr auto float_max = std::numeric_limits<float>::max();
-
-        m_drawables.emplace_back(&dr);
+        Record record{};
+        record.drawable = &dr;
+        record.object = &dr;
+        record.has_position = introspect::has_getPosition_v<T>;
         if constexpr(introspect::has_getPosition_v<T>)
-            m_position_getters[&dr] = [&dr]() { return dr.getPosition(); };
+            record.position_getter = [](const void* obj) -> sf::Vector2f { return static_cast<const T*>(obj)->getPosition(); };
         else
-            m_position_getters[&dr] = []() { return sf::Vector2f{0, float_min}; };
+            record.position_getter = [](const void*) { return sf::Vector2f{0, std::numeric_limits<float>::lowest()}; };
 
         if constexpr(introspect::has_getGlobalBounds_v<T>)
-            m_bounds_getters[&dr] = [&dr]() { return dr.getGlobalBounds(); };
+            record.bounds_getter = [](const void* obj) -> sf::FloatRect { return static_cast<const T*>(obj)->getGlobalBounds(); };
         else if constexpr(introspect::has_getBounds_v<T>)
-            m_bounds_getters[&dr] = [&dr]() { return dr.getBounds(); };
+            record.bounds_getter = [](const void* obj) -> sf::FloatRect { return static_cast<const T*>(obj)->getBounds(); };
         else
-            m_bounds_getters[&dr] = []() { return sf::FloatRect(float_min/2.f, float_min/2.f, float_max, float_max); };
+            record.bounds_getter = [](const void*) {
+                constexpr auto float_min = std::numeric_limits<float>::lowest();
+                constexpr auto float_max = std::numeric_limits<float>::max();
+                return sf::FloatRect(float_min/2.f, float_min/2.f, float_max, float_max);
+            };
+
+        if constexpr(introspect::is_batchable_v<T>) {
+            record.texture_getter = [](const void* obj) -> const sf::Texture* { return static_cast<const T*>(obj)->getTexture(); };
+            record.batch = [](const void* obj, std::vector<sf::Vertex>& vertices) { static_cast<const T*>(obj)->batchTriangles(vertices); };
+        }
+
+        addRecord(record);
     }
 
     template <typename T, typename, typename>
     void Layer::add(const T dr) {
         add(*dr);
         m_gc.emplace_back(dr);
+        Allocations::record(1, 1, sizeof(*dr));
     }
 
     template <typename T, typename, typename>
@@ -141,16 +322,26 @@ namespace ns {
 
     template <typename T, typename>
     void Layer::remove(const T& dr) {
-        auto it = std::find(m_drawables.begin(), m_drawables.end(), &dr);
-        if (it != m_drawables.end()) {
-            m_drawables.erase(it);
-            m_position_getters.erase(&dr);
-            m_bounds_getters.erase(&dr);
-        }
-        else
+        if (!removeRecord(&dr))
             std::cout << "Warning : trying to remove a non existent drawable from Layer.\n";
     }
 
+    template <typename F>
+    void Layer::forEachRecordIn(const sf::FloatRect& area, F&& fn) const {
+        if (!m_spatial_index) {
+            for (const auto& record : m_records)
+                if (area.intersects(record.bounds_getter(record.object)))
+                    fn(record);
+            return;
+        }
+        m_query_indices.clear();
+        m_spatial_index->query(area, [this](std::uint32_t id) { m_query_indices.push_back(m_indices[id]); });
+        // the grid does not keep the drawing order
+        std::sort(m_query_indices.begin(), m_query_indices.end());
+        for (auto index : m_query_indices)
+            fn(m_records[index]);
+    }
+
     template <typename T, typename, typename>
     void Layer::remove(const T dr) {
         remove(*dr);
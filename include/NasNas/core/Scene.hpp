@@ -6,11 +6,14 @@
 #pragma once
 
 #include <list>
+#include <cstdint>
 #include <string>
 
 #include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/View.hpp>
 
 #include <NasNas/core/data/Rect.hpp>
+#include <NasNas/core/graphics/RenderQueue.hpp>
 #include <NasNas/core/Layer.hpp>
 
 namespace ns {
@@ -39,6 +42,7 @@ namespace ns {
         template <typename... T>
         void createLayers(const T&... name) {
             (m_layers.emplace_back(name), ...);
+            m_version++;
         }
 
         /**
@@ -65,18 +69,52 @@ namespace ns {
          */
          auto getDefaultLayer() -> Layer&;
 
+        /**
+         * \brief Enables or disables the batching of the Scene drawables
+         *
+         * When enabled (default), consecutive ns::Sprite, ns::BitmapText and ns::ui::NineSlice
+         * sharing a texture are merged in a single draw call. Disable it if you use classes
+         * deriving from them that override `draw`.
+         *
+         * \param value True to enable batching
+         */
+        void setBatching(bool value);
+
+        auto isBatching() const -> bool;
+
+        /**
+         * \brief Get the modification counter of the Scene
+         *
+         * It changes each time a Layer is created, deleted or modified (see Layer::getVersion).
+         *
+         * \return Scene version
+         */
+        auto getVersion() const -> std::uint64_t;
+
+        /**
+         * \brief Get the RenderQueue used by the last render pass, to inspect its statistics
+         *
+         * \return Const reference to the RenderQueue
+         */
+        auto getRenderQueue() const -> const RenderQueue&;
+
     private:
         std::string m_name;         ///< Scene name
         std::list<Layer> m_layers;
         Layer m_default_layer;
         ns::FloatRect m_render_bounds;
+        float m_alpha = 1.f;        ///< Interpolation factor of the current render pass
+        bool m_batching = true;
+        std::uint64_t m_version = 0;   ///< Incremented by the changes that are not counted by the Layers versions
+        mutable RenderQueue m_render_queue;     ///< Filled and flushed by each render pass
 
         /**
         * \brief Temporary links the Scene to a Camera for rendering
         *
-        * \param camera Camera object to link
+        * \param view View of the Camera
+        * \param alpha Interpolation factor of the interpolated Layers, see App::getInterpolation
         */
-        void temporaryLinkCamera(Camera* camera);
+        void temporaryLinkCamera(const sf::View& view, float alpha);
 
         /**
          * \brief Draws the Scene sprite on the AppWindow
@@ -87,13 +125,20 @@ namespace ns {
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
         /**
-         * \brief Draws a Layer on the AppWindow
+         * \brief Pushes the visible drawables of all the Layers in a RenderQueue
          *
-         * \param target AppWindow
-         * \param states Render states
+         * \param queue RenderQueue to fill
+         */
+        void queueLayers(RenderQueue& queue) const;
+
+        /**
+         * \brief Pushes the visible drawables of a Layer in a RenderQueue
+         *
+         * \param queue RenderQueue to fill
          * \param layer Layer to be drawn
+         * \param order Order of the Layer in the Scene
          */
-        void drawLayer(sf::RenderTarget& target, sf::RenderStates& states, const ns::Layer& layer) const;
+        void queueLayer(RenderQueue& queue, const ns::Layer& layer, std::uint16_t order) const;
     };
 
 }
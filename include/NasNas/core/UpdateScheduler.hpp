@@ -0,0 +1,127 @@
+#pragma once
+
+namespace ns {
+
+    /**
+     * \brief Decides how many fixed updates run each frame
+     *
+     * The elapsed real time is accumulated and consumed by slices of 1/UPS seconds.
+     * When the updates can not keep up, at most `max catch up steps` updates run in a frame,
+     * and the remaining slices are dropped : the simulation slows down instead of spending
+     * more and more time catching up (spiral of death).
+     * With a dynamic update rate, the UPS is lowered while slices are dropped and raised back
+     * when the updates keep up again. Updates should then use App::getDt.
+     */
+    class UpdateScheduler {
+    public:
+        /**
+         * \brief Update counters of one second
+         */
+        struct Stats {
+            unsigned updates = 0;       ///< Updates that ran
+            unsigned late = 0;          ///< Updates that ran to catch up, in a frame that already had an update
+            unsigned skipped = 0;       ///< Slices dropped because of the catch up limit
+            float dropped_time = 0.f;   ///< Time of the dropped slices, in seconds
+            int update_rate = 0;        ///< UPS at the end of the second
+        };
+
+        /**
+         * \brief Constructs an UpdateScheduler
+         *
+         * \param update_rate Number of updates per second
+         */
+        explicit UpdateScheduler(int update_rate=60);
+
+        /**
+         * \brief Set the nominal update rate, also the maximum rate when the rate is dynamic
+         *
+         * \param update_rate Number of updates per second
+         */
+        void setUpdateRate(int update_rate);
+
+        /**
+         * \brief Get the current update rate, lower than the nominal one if it was reduced
+         */
+        auto getUpdateRate() const -> int;
+
+        /**
+         * \brief Get the duration of an update slice, 1/UPS
+         */
+        auto getSliceTime() const -> float;
+
+        /**
+         * \brief Set the maximum number of updates run in a single frame
+         *
+         * \param steps Maximum number of updates, at least 1
+         */
+        void setMaxCatchUpSteps(unsigned steps);
+
+        auto getMaxCatchUpSteps() const -> unsigned;
+
+        /**
+         * \brief Allows the scheduler to lower the update rate when the updates can not keep up
+         *
+         * The rate is lowered by 10% each second with dropped slices, and raised by 10% each second
+         * without late updates, up to the nominal rate.
+         *
+         * \param value True to enable the dynamic update rate
+         * \param min_update_rate Update rate never gone below
+         */
+        void setDynamicUpdateRate(bool value, int min_update_rate=20);
+
+        auto hasDynamicUpdateRate() const -> bool;
+
+        /**
+         * \brief Adds the real time elapsed since the previous frame
+         *
+         * \param dt Elapsed time in seconds
+         */
+        void beginFrame(float dt);
+
+        /**
+         * \brief Consumes an update slice, to be called in a loop until it returns false
+         *
+         * When the catch up limit is reached, the remaining slices are dropped.
+         *
+         * \return True if an update has to run
+         */
+        auto step() -> bool;
+
+        /**
+         * \brief Get the fraction of the next slice already elapsed
+         */
+        auto getAlpha() const -> float;
+
+        /**
+         * \brief Get the time until the next update, in seconds
+         */
+        auto getTimeToNextUpdate() const -> float;
+
+        /**
+         * \brief Get the counters of the last complete second
+         */
+        auto getStats() const -> const Stats&;
+
+        /**
+         * \brief Get the total time dropped since the creation of the scheduler, in seconds
+         */
+        auto getTotalDroppedTime() const -> double;
+
+    private:
+        void endSecond();
+
+        int m_nominal_rate;
+        int m_rate;
+        int m_min_rate = 20;
+        bool m_dynamic = false;
+        unsigned m_max_steps = 5;
+        float m_slice;
+        float m_accumulator;
+        unsigned m_frame_steps = 0;     ///< Updates run in the current frame
+        float m_second_time = 0.f;      ///< Time elapsed in the current second
+        Stats m_current;
+        Stats m_last;
+        double m_total_dropped = 0.;
+    };
+
+}
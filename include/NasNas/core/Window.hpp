@@ -10,9 +10,19 @@
 #include <SFML/Graphics/View.hpp>
 
 namespace ns {
+    class App;
 
     class AppWindow : public sf::RenderWindow {
+        friend App;
     public:
+        /**
+         * \brief Closes the window
+         *
+         * When the App renders on a separate thread, the window is closed by the App
+         * once the render thread is stopped, at the end of the current frame.
+         */
+        void close();
+
         /**
          * \brief Get App View defined by user
          *
@@ -45,6 +55,8 @@ namespace ns {
         sf::Color m_clear_color;///< Window clear color
         sf::View m_app_view;            ///< App view defined by use
         sf::View m_screen_view;         ///< Screen view, same size as the window
+        bool m_defer_close = false;     ///< Set by the App while the render thread is running
+        bool m_close_requested = false;
 
         void onCreate() override;
         void onResize() override;
@@ -32,6 +32,22 @@ namespace ns {
         bool key_repeat = false;
         bool cursor_visible = true;
         bool cursor_grabbed = false;
+        /// Draw Cameras and App content straight on the window when no shader is set and the scale is an integer.
+        /// When false, content is always rendered at the App resolution first (drawables positions snapped to its pixels).
+        bool direct_rendering = false;
+        /// Render on a dedicated thread while the next frame is updated (see App::run).
+        bool render_thread = false;
+        /// Number of frames buffered between the update thread and the render thread, 2 or 3.
+        unsigned render_buffers = 2;
+        /// Run without window nor OpenGL context, for simulations, tests and benchmarks (see App::run).
+        bool headless = false;
+        /// In headless mode, pace the updates in real time instead of running them as fast as possible.
+        bool headless_realtime = false;
+        /// In headless mode, generate the vertices of the visible drawables each frame, without drawing them.
+        bool headless_vertex_pass = true;
+        /// Watch the assets loaded from files (ResourceManager directory, TiledMaps, tilesets, ShaderHolder shaders)
+        /// and reload them when they change, see FileWatcher.
+        bool hot_reload = false;
 
         auto getViewSize() const -> const sf::Vector2f&;
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns {
+
+    /**
+     * \brief Watches files and directories and notifies their changes, to reload assets without restarting the app
+     *
+     * On Linux, changes are reported by inotify. On the other platforms, or if inotify is not available,
+     * the watched files modification times are polled. Android assets can not change and are never watched.
+     *
+     * Changes are debounced : a file is notified once it did not change for the debounce delay, so a file
+     * written in several steps is reloaded once. The App updates the default watcher each frame.
+     *
+     * Callbacks are called in the order of the watches registration.
+     */
+    class FileWatcher {
+    public:
+        /// Called on the thread updating the watcher with the absolute path of the changed file
+        using Callback = std::function<void(const std::string&)>;
+        /// Called on a worker thread with the absolute path of the changed file (to read or decode it),
+        /// the returned function is called on the thread updating the watcher (to apply the change)
+        using AsyncCallback = std::function<std::function<void()>(const std::string&)>;
+
+        FileWatcher();
+        ~FileWatcher();
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /**
+         * \brief Get the watcher updated by the App
+         */
+        static auto getDefault() -> FileWatcher&;
+
+        /**
+         * \brief Watches a file, or all the files of a directory and its sub directories
+         *
+         * \param path File or directory to watch
+         * \param callback Function called when a watched file changed
+         *
+         * \return Id of the watch, to unwatch it
+         */
+        auto watch(const std::string& path, Callback callback) -> std::size_t;
+
+        /**
+         * \brief Watches a file or a directory, the changes are loaded on the default ThreadPool
+         *
+         * \param path File or directory to watch
+         * \param callback Function called on a worker thread when a watched file changed
+         *
+         * \return Id of the watch, to unwatch it
+         */
+        auto watchAsync(const std::string& path, AsyncCallback callback) -> std::size_t;
+
+        /**
+         * \brief Stops watching, the changes being loaded are not applied
+         *
+         * \param id Id returned by `watch` or `watchAsync`
+         */
+        void unwatch(std::size_t id);
+
+        /**
+         * \brief Set the time a file must not change before it is notified, 100ms by default
+         */
+        void setDebounceDelay(std::chrono::milliseconds delay);
+
+        /**
+         * \brief Set the time between two checks of the modification times when polling, 500ms by default
+         */
+        void setPollingInterval(std::chrono::milliseconds interval);
+
+        /**
+         * \brief Is the watcher polling the files instead of being notified by the system ?
+         */
+        auto isPolling() const -> bool;
+
+        /**
+         * \brief Collects the changes, calls the callbacks of the debounced ones and applies the loaded changes
+         */
+        void update();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        class Backend;
+        class InotifyBackend;
+        class PollingBackend;
+
+        struct Watch {
+            std::size_t id;
+            std::string path;
+            bool directory;
+            Callback callback;
+            AsyncCallback async_callback;
+        };
+        struct PendingApply {
+            std::size_t watch_id;
+            std::future<std::function<void()>> apply;
+        };
+
+        auto addWatch(const std::string& path, Callback callback, AsyncCallback async_callback) -> std::size_t;
+        void dispatch(const std::string& path);
+
+        std::unique_ptr<Backend> m_backend;
+        std::vector<Watch> m_watches;
+        std::size_t m_next_id = 1;
+        std::unordered_map<std::string, Clock::time_point> m_changes;      ///< Changed files, by time of their last change
+        std::vector<PendingApply> m_applies;
+        std::chrono::milliseconds m_debounce{100};
+        std::chrono::milliseconds m_polling_interval{500};
+        Clock::time_point m_last_poll;
+    };
+
+}
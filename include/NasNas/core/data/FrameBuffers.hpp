@@ -0,0 +1,141 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace ns {
+
+    /**
+     * \brief Ring of buffers shared by a producer thread and a consumer thread
+     *
+     * The producer writes a buffer and publishes it, the consumer always reads the most recently
+     * published buffer. The producer never waits : if no buffer is free, it takes back the published
+     * buffer that was not read yet, and that frame is dropped. With 3 buffers or more, a published
+     * buffer is never taken back while the consumer is reading.
+     *
+     * \tparam T Type of the buffers
+     */
+    template <typename T>
+    class FrameBuffers {
+    public:
+        /**
+         * \brief Constructs the buffers
+         *
+         * \param count Number of buffers, at least 2
+         */
+        explicit FrameBuffers(std::size_t count=2);
+
+        /**
+         * \brief Get a buffer to write the next frame in, never blocks
+         *
+         * \return Reference to the buffer
+         */
+        auto beginWrite() -> T&;
+
+        /**
+         * \brief Publishes the buffer returned by the last `beginWrite`
+         */
+        void endWrite();
+
+        /**
+         * \brief Waits for a frame newer than the last one read
+         *
+         * \return Pointer to the buffer, or nullptr if `stop` was called
+         */
+        auto beginRead() -> T*;
+
+        /**
+         * \brief Releases the buffer returned by the last `beginRead`
+         */
+        void endRead();
+
+        /**
+         * \brief Wakes up the consumer, `beginRead` returns nullptr from now on
+         */
+        void stop();
+
+        /**
+         * \brief Get the number of published frames taken back before being read
+         */
+        auto getDroppedCount() const -> std::size_t;
+
+    private:
+        static constexpr int None = -1;
+
+        std::vector<T> m_buffers;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_published;
+        int m_writing = None;
+        int m_ready = None;
+        int m_reading = None;
+        bool m_stopped = false;
+        std::size_t m_dropped = 0;
+    };
+
+    template <typename T>
+    FrameBuffers<T>::FrameBuffers(std::size_t count) : m_buffers(count < 2 ? 2 : count)
+    {}
+
+    template <typename T>
+    auto FrameBuffers<T>::beginWrite() -> T& {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (int i = 0; i < static_cast<int>(m_buffers.size()); ++i) {
+            if (i != m_ready && i != m_reading) {
+                m_writing = i;
+                return m_buffers[i];
+            }
+        }
+        // the only buffer left is the unread one, its frame is dropped
+        m_writing = m_ready;
+        m_ready = None;
+        m_dropped++;
+        return m_buffers[m_writing];
+    }
+
+    template <typename T>
+    void FrameBuffers<T>::endWrite() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_ready != None)
+                m_dropped++;
+            m_ready = m_writing;
+            m_writing = None;
+        }
+        m_published.notify_one();
+    }
+
+    template <typename T>
+    auto FrameBuffers<T>::beginRead() -> T* {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_published.wait(lock, [this] { return m_stopped || m_ready != None; });
+        if (m_stopped)
+            return nullptr;
+        m_reading = m_ready;
+        m_ready = None;
+        return &m_buffers[m_reading];
+    }
+
+    template <typename T>
+    void FrameBuffers<T>::endRead() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_reading = None;
+    }
+
+    template <typename T>
+    void FrameBuffers<T>::stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopped = true;
+        }
+        m_published.notify_all();
+    }
+
+    template <typename T>
+    auto FrameBuffers<T>::getDroppedCount() const -> std::size_t {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_dropped;
+    }
+
+}
@@ -2,6 +2,11 @@
 
 #pragma once
 
+#include <type_traits>
+#include <vector>
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <NasNas/core/data/Rect.hpp>
@@ -34,4 +39,17 @@ namespace introspect {
     NS_DEFINE_HAS_METHOD(getGlobalBounds, ns::FloatRect());
     NS_DEFINE_HAS_METHOD(getBounds, ns::FloatRect());
     NS_DEFINE_HAS_METHOD(update, void());
+
+    /// True if T can append its triangles to a vertices array with `batchTriangles`, has a `getTexture` method,
+    /// and opts in with a `Batchable` alias naming T itself (an inherited alias names the base class)
+    template <typename T, typename=void>
+    struct is_batchable : false_type {};
+    template <typename T>
+    struct is_batchable<T, void_t<
+        enable_if_t<is_same_v<typename T::Batchable, T>>,
+        decltype(declval<const T&>().batchTriangles(declval<std::vector<sf::Vertex>&>())),
+        enable_if_t<is_convertible_v<decltype(declval<const T&>().getTexture()), const sf::Texture*>>
+    >> : true_type {};
+    template <typename T>
+    inline constexpr bool is_batchable_v = is_batchable<T>::value;
 }
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ns {
+
+    /**
+     * \brief Counts the objects created and the heap allocations made by the framework, per frame
+     *
+     * Objects allocated by the user and owned by the framework (Layer::add with a pointer) are counted too.
+     *
+     * The counters are atomic, objects can be created from any thread.
+     * The App starts a new frame at the beginning of each loop iteration.
+     */
+    class Allocations {
+    public:
+        struct Stats {
+            std::size_t objects = 0;        ///< Objects created, from a pool or from the heap
+            std::size_t allocations = 0;    ///< Heap allocations
+            std::size_t bytes = 0;          ///< Bytes allocated from the heap
+        };
+
+        /**
+         * \brief Get the counters of the last complete frame
+         */
+        static auto getFrameStats() -> Stats;
+
+        /**
+         * \brief Get the counters since the start of the program
+         */
+        static auto getTotalStats() -> Stats;
+
+        /**
+         * \brief Ends the current frame, called by the App each frame
+         */
+        static void newFrame();
+
+        /**
+         * \brief Records objects creations and heap allocations in the current frame
+         *
+         * \param objects Number of objects created
+         * \param allocations Number of heap allocations
+         * \param bytes Number of bytes allocated from the heap
+         */
+        static void record(std::size_t objects, std::size_t allocations, std::size_t bytes);
+
+    private:
+        struct Counters {
+            std::atomic<std::size_t> objects{0};
+            std::atomic<std::size_t> allocations{0};
+            std::atomic<std::size_t> bytes{0};
+        };
+        static Counters m_current;
+        static Counters m_total;
+        static Stats m_last_frame;
+    };
+
+    /**
+     * \brief Storage for short lived objects, all released at once when the arena is reset
+     *
+     * Objects are stored in chunks that are kept between resets, so once the arena has grown
+     * to the number of objects created in a frame, creating objects does not allocate anymore.
+     * The objects are not destroyed on reset, they are overwritten by the next `create` calls.
+     *
+     * \tparam T Type of the objects, must be default constructible and move assignable
+     */
+    template <typename T>
+    class FrameArena {
+    public:
+        /**
+         * \brief Constructs an empty arena
+         *
+         * \param chunk_size Number of objects per chunk
+         */
+        explicit FrameArena(std::size_t chunk_size=256);
+
+        /**
+         * \brief Creates an object valid until the next `reset`
+         *
+         * \param args Arguments forwarded to the constructor of T
+         *
+         * \return Pointer to the object
+         */
+        template <typename... Args>
+        auto create(Args&&... args) -> T*;
+
+        /**
+         * \brief Releases all the objects, their memory is reused by the next `create` calls
+         */
+        void reset();
+
+        /**
+         * \brief Does this arena own the given object ?
+         */
+        auto contains(const T* object) const -> bool;
+
+        auto size() const -> std::size_t;
+
+        auto capacity() const -> std::size_t;
+
+    private:
+        std::size_t m_chunk_size;
+        std::size_t m_size = 0;
+        std::vector<std::unique_ptr<T[]>> m_chunks;
+        std::vector<std::pair<const T*, std::size_t>> m_sorted_chunks;   ///< Chunks sorted by address, for `contains`
+    };
+
+    /**
+     * \brief Storage for long lived objects of the same type, created and destroyed in any order
+     *
+     * Objects are stored in chunks and the slots of destroyed objects are reused.
+     * Pointers to the objects stay valid until they are destroyed.
+     * The objects still alive are destroyed with the pool.
+     *
+     * \tparam T Type of the objects
+     */
+    template <typename T>
+    class ObjectPool {
+    public:
+        /**
+         * \brief Constructs an empty pool
+         *
+         * \param chunk_size Number of objects per chunk
+         */
+        explicit ObjectPool(std::size_t chunk_size=256);
+        ~ObjectPool();
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        /**
+         * \brief Creates an object in a free slot
+         *
+         * \param args Arguments forwarded to the constructor of T
+         *
+         * \return Pointer to the object
+         */
+        template <typename... Args>
+        auto create(Args&&... args) -> T*;
+
+        /**
+         * \brief Destroys an object created by this pool, its slot is reused by the next `create`
+         *
+         * \param object Object to destroy
+         */
+        void destroy(T* object);
+
+        /**
+         * \brief Destroys all the objects, the memory is kept
+         */
+        void clear();
+
+        auto size() const -> std::size_t;
+
+        auto capacity() const -> std::size_t;
+
+    private:
+        /// The object is at the beginning of its slot, destroying it needs no chunk lookup
+        struct Slot {
+            alignas(T) unsigned char storage[sizeof(T)];
+            Slot* next = nullptr;       ///< Next free slot, when not alive
+            bool alive = false;
+
+            auto object() -> T* { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        std::size_t m_chunk_size;
+        std::size_t m_size = 0;
+        std::vector<std::unique_ptr<Slot[]>> m_chunks;
+        Slot* m_free = nullptr;
+    };
+
+    template <typename T>
+    FrameArena<T>::FrameArena(std::size_t chunk_size) : m_chunk_size(std::max<std::size_t>(chunk_size, 1))
+    {}
+
+    template <typename T>
+    template <typename... Args>
+    auto FrameArena<T>::create(Args&&... args) -> T* {
+        const auto chunk = m_size / m_chunk_size;
+        if (chunk == m_chunks.size()) {
+            m_chunks.emplace_back(new T[m_chunk_size]);
+            const std::pair<const T*, std::size_t> entry = {m_chunks.back().get(), chunk};
+            auto pos = std::upper_bound(m_sorted_chunks.begin(), m_sorted_chunks.end(), entry,
+                                        [](const auto& lhs, const auto& rhs) { return std::less<const T*>()(lhs.first, rhs.first); });
+            m_sorted_chunks.insert(pos, entry);
+            Allocations::record(0, 1, m_chunk_size * sizeof(T));
+        }
+        auto* object = &m_chunks[chunk][m_size % m_chunk_size];
+        *object = T(std::forward<Args>(args)...);
+        m_size++;
+        Allocations::record(1, 0, 0);
+        return object;
+    }
+
+    template <typename T>
+    void FrameArena<T>::reset() {
+        m_size = 0;
+    }
+
+    template <typename T>
+    auto FrameArena<T>::contains(const T* object) const -> bool {
+        // last chunk starting before the object
+        auto it = std::upper_bound(m_sorted_chunks.begin(), m_sorted_chunks.end(), object,
+                                   [](const T* obj, const auto& entry) { return std::less<const T*>()(obj, entry.first); });
+        if (it == m_sorted_chunks.begin())
+            return false;
+        const auto& [begin, chunk] = *std::prev(it);
+        if (chunk * m_chunk_size >= m_size)
+            return false;
+        const auto used = std::min(m_chunk_size, m_size - chunk * m_chunk_size);
+        return std::less<const T*>()(object, begin + used);
+    }
+
+    template <typename T>
+    auto FrameArena<T>::size() const -> std::size_t {
+        return m_size;
+    }
+
+    template <typename T>
+    auto FrameArena<T>::capacity() const -> std::size_t {
+        return m_chunks.size() * m_chunk_size;
+    }
+
+    template <typename T>
+    ObjectPool<T>::ObjectPool(std::size_t chunk_size) : m_chunk_size(std::max<std::size_t>(chunk_size, 1))
+    {}
+
+    template <typename T>
+    ObjectPool<T>::~ObjectPool() {
+        clear();
+    }
+
+    template <typename T>
+    template <typename... Args>
+    auto ObjectPool<T>::create(Args&&... args) -> T* {
+        if (m_free == nullptr) {
+            auto& chunk = m_chunks.emplace_back(new Slot[m_chunk_size]);
+            // the free list goes through the new slots in order
+            for (std::size_t i = m_chunk_size; i > 0; --i) {
+                chunk[i-1].next = m_free;
+                m_free = &chunk[i-1];
+            }
+            Allocations::record(0, 1, m_chunk_size * sizeof(Slot));
+        }
+        auto* slot = m_free;
+        auto* object = new (slot->storage) T(std::forward<Args>(args)...);
+        m_free = slot->next;
+        slot->alive = true;
+        m_size++;
+        Allocations::record(1, 0, 0);
+        return object;
+    }
+
+    template <typename T>
+    void ObjectPool<T>::destroy(T* object) {
+        auto* slot = reinterpret_cast<Slot*>(object);
+        if (!slot->alive)
+            return;
+        object->~T();
+        slot->alive = false;
+        slot->next = m_free;
+        m_free = slot;
+        m_size--;
+    }
+
+    template <typename T>
+    void ObjectPool<T>::clear() {
+        for (auto& chunk : m_chunks) {
+            for (std::size_t i = 0; i < m_chunk_size; ++i) {
+                if (chunk[i].alive) {
+                    chunk[i].object()->~T();
+                    chunk[i].alive = false;
+                    chunk[i].next = m_free;
+                    m_free = &chunk[i];
+                }
+            }
+        }
+        m_size = 0;
+    }
+
+    template <typename T>
+    auto ObjectPool<T>::size() const -> std::size_t {
+        return m_size;
+    }
+
+    template <typename T>
+    auto ObjectPool<T>::capacity() const -> std::size_t {
+        return m_chunks.size() * m_chunk_size;
+    }
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ns::utils {
+
+    /**
+     * \brief Small, fast and seedable pseudo random numbers generator (PCG32)
+     *
+     * Two generators constructed with the same seed and stream always produce the same sequence,
+     * and generators sharing a seed but using different streams produce independent sequences.
+     * Giving each task of a parallel system its own stream (its chunk index for example)
+     * makes the results reproducible whatever the number of threads.
+     *
+     * Random is not thread safe, use one generator per thread. `Random::get()`
+     * returns a generator owned by the calling thread.
+     */
+    class Random {
+    public:
+        /**
+         * \brief Constructs a generator from a seed and a stream
+         *
+         * \param seed Initial state of the generator
+         * \param stream Stream selector, generators using different streams are independent
+         */
+        explicit Random(std::uint64_t seed=DefaultSeed, std::uint64_t stream=0);
+
+        /**
+         * \brief Resets the generator state
+         *
+         * \param seed Initial state of the generator
+         * \param stream Stream selector
+         */
+        void seed(std::uint64_t seed, std::uint64_t stream=0);
+
+        /**
+         * \brief Generates the next 32 bits random value
+         *
+         * \return Random value
+         */
+        auto next() -> std::uint32_t;
+
+        /**
+         * \brief Generates a float uniformly distributed in [min, max)
+         *
+         * \return Random float
+         */
+        auto uniform(float min, float max) -> float;
+
+        /**
+         * \brief Generates an integer uniformly distributed in [min, max), without modulo bias
+         *
+         * \return Random integer, or min if max <= min
+         */
+        auto uniform(int min, int max) -> int;
+
+        /**
+         * \brief Fills an array with floats uniformly distributed in [min, max)
+         *
+         * Every element is computed independently from a counter so the loop can be vectorized.
+         * The generator is advanced once per call, whatever the size of the array.
+         *
+         * \param output Array to fill
+         * \param count Number of floats to write
+         */
+        void fillUniform(float* output, std::size_t count, float min, float max);
+
+        /**
+         * \brief Get the generator of the calling thread
+         *
+         * Each thread generator is seeded from the global seed (see `setRandomSeed`)
+         * and uses the order in which threads first called `get` as stream.
+         *
+         * \return Reference to the calling thread generator
+         */
+        static auto get() -> Random&;
+
+        static constexpr std::uint64_t DefaultSeed = 0x853c49e6748fea9bULL;
+
+    private:
+        std::uint64_t m_state = 0;
+        std::uint64_t m_increment = 1;
+    };
+
+    /**
+     * \brief Reseeds the calling thread generator, and the generators of threads that did not use theirs yet
+     *
+     * \param seed New global seed
+     */
+    void setRandomSeed(std::uint64_t seed);
+
+}
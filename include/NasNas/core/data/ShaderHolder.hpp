@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include <SFML/Graphics/Shader.hpp>
 
 namespace ns {
@@ -35,7 +38,22 @@ namespace ns {
          */
         void clearShader();
 
+        /**
+         * \brief Loads a shader from files and set it as the current shader
+         *
+         * The shader is owned by the holder. With the `hot_reload` AppConfig, it is compiled again
+         * when one of its files changes, and replaced only if the new version compiles.
+         *
+         * \param vertex_file Vertex shader file, or an empty string
+         * \param fragment_file Fragment shader file, or an empty string
+         *
+         * \return True if the shader was loaded
+         */
+        auto loadShader(const std::string& vertex_file, const std::string& fragment_file) -> bool;
+
     private:
+        class LoadedShader;
+        std::shared_ptr<LoadedShader> m_loaded_shader;
         sf::Shader* m_shader = nullptr;
         sf::Shader* m_saved_shared = nullptr;
     };
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+
+namespace ns {
+
+    /**
+     * \brief Uniform grid of buckets used to quickly find the items overlapping an area
+     *
+     * Each item is stored in all the cells its bounds overlap. Items overlapping too many cells
+     * (background, unbounded drawables, ...) are kept in a separate list tested on every query.
+     *
+     * \tparam T Type of the items, must be hashable (usually a pointer or an index)
+     */
+    template <typename T>
+    class SpatialGrid {
+    public:
+        /**
+         * \brief Constructs an empty SpatialGrid
+         *
+         * \param cell_size Size of the square cells, should be close to the size of the items
+         */
+        explicit SpatialGrid(float cell_size=256.f);
+
+        auto getCellSize() const -> float;
+
+        auto getItemsCount() const -> std::size_t;
+
+        /**
+         * \brief Adds an item to the grid
+         *
+         * \param item Item to add
+         * \param bounds Bounds of the item
+         */
+        void insert(const T& item, const sf::FloatRect& bounds);
+
+        /**
+         * \brief Moves an item already in the grid to its new bounds
+         *
+         * \param item Item to update
+         * \param bounds New bounds of the item
+         */
+        void update(const T& item, const sf::FloatRect& bounds);
+
+        /**
+         * \brief Removes an item from the grid
+         *
+         * \param item Item to remove
+         */
+        void remove(const T& item);
+
+        void clear();
+
+        /**
+         * \brief Calls `fn` once for each item whose bounds intersect the given area
+         *
+         * \param area Area to query
+         * \param fn Function taking the item as parameter
+         */
+        template <typename F>
+        void query(const sf::FloatRect& area, F&& fn) const;
+
+    private:
+        /// Items covering more cells than this are not inserted in the cells
+        static constexpr int MaxCellsPerItem = 64;
+
+        struct CellRange {
+            int left = 0, top = 0, right = -1, bottom = -1;
+            auto count() const -> long long { return (long long)(right - left + 1) * (bottom - top + 1); }
+        };
+
+        struct Entry {
+            T item;
+            sf::FloatRect bounds;
+            CellRange range;
+        };
+
+        auto computeRange(const sf::FloatRect& bounds) const -> CellRange;
+        static auto key(int x, int y) -> std::uint64_t;
+        static auto intersects(const sf::FloatRect& a, const sf::FloatRect& b) -> bool;
+
+        float m_cell_size;
+        std::unordered_map<std::uint64_t, std::vector<Entry>> m_cells;
+        std::unordered_map<T, CellRange> m_ranges;
+        std::vector<Entry> m_large_items;
+    };
+
+    template <typename T>
+    SpatialGrid<T>::SpatialGrid(float cell_size) : m_cell_size(cell_size)
+    {}
+
+    template <typename T>
+    auto SpatialGrid<T>::getCellSize() const -> float {
+        return m_cell_size;
+    }
+
+    template <typename T>
+    auto SpatialGrid<T>::getItemsCount() const -> std::size_t {
+        return m_ranges.size();
+    }
+
+    template <typename T>
+    void SpatialGrid<T>::insert(const T& item, const sf::FloatRect& bounds) {
+        auto range = computeRange(bounds);
+        if (range.count() > MaxCellsPerItem) {
+            m_large_items.push_back({item, bounds, CellRange()});
+            m_ranges[item] = CellRange();
+            return;
+        }
+        for (int y = range.top; y <= range.bottom; ++y)
+            for (int x = range.left; x <= range.right; ++x)
+                m_cells[key(x, y)].push_back({item, bounds, range});
+        m_ranges[item] = range;
+    }
+
+    template <typename T>
+    void SpatialGrid<T>::update(const T& item, const sf::FloatRect& bounds) {
+        auto it = m_ranges.find(item);
+        if (it != m_ranges.end() && it->second.count() > 0 && it->second.count() <= MaxCellsPerItem) {
+            // same cells, only the bounds have to be updated
+            auto range = computeRange(bounds);
+            const auto& old = it->second;
+            if (range.left == old.left && range.top == old.top && range.right == old.right && range.bottom == old.bottom) {
+                for (int y = range.top; y <= range.bottom; ++y)
+                    for (int x = range.left; x <= range.right; ++x)
+                        for (auto& entry : m_cells[key(x, y)])
+                            if (entry.item == item)
+                                entry.bounds = bounds;
+                return;
+            }
+        }
+        remove(item);
+        insert(item, bounds);
+    }
+
+    template <typename T>
+    void SpatialGrid<T>::remove(const T& item) {
+        auto it = m_ranges.find(item);
+        if (it == m_ranges.end())
+            return;
+        auto erase_from = [&item](std::vector<Entry>& entries) {
+            auto entry = std::find_if(entries.begin(), entries.end(), [&](const Entry& e) { return e.item == item; });
+            if (entry != entries.end()) {
+                *entry = std::move(entries.back());
+                entries.pop_back();
+            }
+        };
+        const auto& range = it->second;
+        if (range.count() == 0)
+            erase_from(m_large_items);
+        for (int y = range.top; y <= range.bottom; ++y) {
+            for (int x = range.left; x <= range.right; ++x) {
+                auto cell = m_cells.find(key(x, y));
+                erase_from(cell->second);
+                if (cell->second.empty())
+                    m_cells.erase(cell);
+            }
+        }
+        m_ranges.erase(it);
+    }
+
+    template <typename T>
+    void SpatialGrid<T>::clear() {
+        m_cells.clear();
+        m_ranges.clear();
+        m_large_items.clear();
+    }
+
+    template <typename T>
+    template <typename F>
+    void SpatialGrid<T>::query(const sf::FloatRect& area, F&& fn) const {
+        for (const auto& entry : m_large_items)
+            if (intersects(area, entry.bounds))
+                fn(entry.item);
+
+        const auto range = computeRange(area);
+        // an item spanning several cells is only reported by the first cell shared with the query
+        auto visit = [&](int x, int y, const std::vector<Entry>& entries) {
+            for (const auto& entry : entries) {
+                if (x == std::max(entry.range.left, range.left) && y == std::max(entry.range.top, range.top)
+                    && intersects(area, entry.bounds))
+                    fn(entry.item);
+            }
+        };
+
+        if (range.count() > static_cast<long long>(m_cells.size())) {
+            // large area, cheaper to go through the non empty cells
+            for (const auto& [cell_key, entries] : m_cells) {
+                auto x = static_cast<int>(static_cast<std::int32_t>(cell_key >> 32u));
+                auto y = static_cast<int>(static_cast<std::int32_t>(cell_key & 0xffffffffu));
+                if (x >= range.left && x <= range.right && y >= range.top && y <= range.bottom)
+                    visit(x, y, entries);
+            }
+        }
+        else {
+            for (int y = range.top; y <= range.bottom; ++y) {
+                for (int x = range.left; x <= range.right; ++x) {
+                    auto cell = m_cells.find(key(x, y));
+                    if (cell != m_cells.end())
+                        visit(x, y, cell->second);
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    auto SpatialGrid<T>::computeRange(const sf::FloatRect& bounds) const -> CellRange {
+        // clamp to avoid overflows with huge bounds, they end up in the large items anyway
+        constexpr float limit = 1e9f;
+        auto to_cell = [&](float v) {
+            return static_cast<int>(std::floor(std::clamp(v, -limit, limit) / m_cell_size));
+        };
+        return {
+            to_cell(bounds.left), to_cell(bounds.top),
+            to_cell(bounds.left + bounds.width), to_cell(bounds.top + bounds.height)
+        };
+    }
+
+    template <typename T>
+    auto SpatialGrid<T>::key(int x, int y) -> std::uint64_t {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32u) | static_cast<std::uint32_t>(y);
+    }
+
+    template <typename T>
+    auto SpatialGrid<T>::intersects(const sf::FloatRect& a, const sf::FloatRect& b) -> bool {
+        return a.left < b.left + b.width && b.left < a.left + a.width
+            && a.top < b.top + b.height && b.top < a.top + a.height;
+    }
+
+}
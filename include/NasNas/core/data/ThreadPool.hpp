@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ns {
+
+    class ThreadPool {
+    public:
+        /**
+         * \brief Creates a ThreadPool with the given number of worker threads
+         *
+         * A pool with 0 workers is valid, every task will then run on the calling thread.
+         *
+         * \param workers_count Number of worker threads to spawn
+         */
+        explicit ThreadPool(unsigned workers_count);
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * \brief Waits for the queued tasks to finish and joins the worker threads
+         */
+        ~ThreadPool();
+
+        /**
+         * \brief Get the pool shared by the framework
+         *
+         * The default pool spawns one worker less than the number of hardware threads,
+         * the calling thread taking part in the work in `parallelFor`.
+         *
+         * \return Reference to the default ThreadPool
+         */
+        static auto getDefault() -> ThreadPool&;
+
+        /**
+         * \brief Get the number of worker threads of the pool
+         *
+         * \return Number of worker threads
+         */
+        auto getWorkersCount() const -> unsigned;
+
+        /**
+         * \brief Queues a task to be run by one of the workers
+         *
+         * \param fn Task to run
+         *
+         * \return Future holding the result of the task
+         */
+        template <typename F>
+        auto enqueue(F&& fn) -> std::future<std::invoke_result_t<F>>;
+
+        /**
+         * \brief Runs `fn` on consecutive chunks of the [0, count) range, spread across the workers
+         *
+         * Chunks boundaries only depend on `count` and `chunk_size`, never on the number of workers,
+         * so a function writing to disjoint ranges gives the same result whatever the pool size.
+         * The calling thread works on the chunks too and returns once every chunk was processed.
+         *
+         * \param count Size of the range to process
+         * \param chunk_size Number of elements per chunk
+         * \param fn Function called with the [begin, end) bounds of a chunk and the chunk index
+         */
+        void parallelFor(std::size_t count, std::size_t chunk_size, const std::function<void(std::size_t, std::size_t, std::size_t)>& fn);
+
+    private:
+        void workerLoop();
+
+        std::vector<std::thread> m_workers;
+        std::queue<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stop = false;
+    };
+
+    template <typename F>
+    auto ThreadPool::enqueue(F&& fn) -> std::future<std::invoke_result_t<F>> {
+        using R = std::invoke_result_t<F>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+        auto future = task->get_future();
+        if (m_workers.empty()) {
+            (*task)();
+            return future;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace([task] { (*task)(); });
+        }
+        m_condition.notify_one();
+        return future;
+    }
+
+}
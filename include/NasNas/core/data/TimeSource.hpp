@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ns {
+
+    /**
+     * \brief Game time shared by the animations, advanced by the App on each update
+     *
+     * The App advances the default time source by the fixed update time step on each update, so the
+     * tweens, AnimPlayers and animated tiles follow the updates : they stop while the App sleeps and run
+     * as fast as the updates in headless mode. Replaying the same updates replays the same animations.
+     *
+     * Animations belong to a group of the time source (the default group by default). Each group can be
+     * paused and has its own time dilation, on top of the dilation of the whole time source.
+     */
+    class TimeSource {
+    public:
+        using Group = std::uint32_t;
+        static constexpr Group DefaultGroup = 0;
+
+        TimeSource();
+
+        /**
+         * \brief Get the time source advanced by the App
+         */
+        static auto getDefault() -> TimeSource&;
+
+        /**
+         * \brief Advances the time of all the groups not paused
+         *
+         * \param dt Real time elapsed, in seconds, scaled by the dilations
+         */
+        void advance(float dt);
+
+        /**
+         * \brief Get the time of a group, since the time source creation or its last reset
+         *
+         * \param group Group
+         *
+         * \return Time in seconds
+         */
+        auto getTime(Group group=DefaultGroup) const -> double;
+
+        /**
+         * \brief Set the time scale of all the groups, to slow down or fast forward the animations
+         *
+         * \param dilation Time scale, 1 is real time
+         */
+        void setDilation(float dilation);
+        auto getDilation() const -> float;
+
+        /**
+         * \brief Set the time scale of a group, applied on top of the time source dilation
+         *
+         * \param group Group
+         * \param dilation Time scale, 1 is real time
+         */
+        void setDilation(Group group, float dilation);
+        auto getDilation(Group group) const -> float;
+
+        /**
+         * \brief Pauses a group, its time does not advance until it is resumed
+         *
+         * \param group Group
+         */
+        void pause(Group group);
+
+        void resume(Group group);
+
+        auto isPaused(Group group) const -> bool;
+
+        /**
+         * \brief Set the time of all the groups back to 0, the dilations and pauses are kept
+         *
+         * Used to replay a simulation from the start, the running clocks measure the time since the reset.
+         */
+        void reset();
+
+        /**
+         * \brief Get the number of resets, for the clocks to detect them
+         */
+        auto getEpoch() const -> std::uint32_t;
+
+    private:
+        struct GroupState {
+            double time = 0.;
+            float dilation = 1.f;
+            bool paused = false;
+        };
+        auto getGroup(Group group) -> GroupState&;
+
+        std::vector<GroupState> m_groups;
+        float m_dilation = 1.f;
+        std::uint32_t m_epoch = 0;
+    };
+
+    /**
+     * \brief Measures time elapsed in a group of a TimeSource, like a sf::Clock measures real time
+     */
+    class GameClock {
+    public:
+        explicit GameClock(TimeSource::Group group=TimeSource::DefaultGroup, const TimeSource& source=TimeSource::getDefault());
+
+        /**
+         * \brief Get the time elapsed since the clock creation, its last restart or the last reset of its time source
+         *
+         * \return Time in seconds
+         */
+        auto getElapsedTime() const -> float;
+
+        /**
+         * \brief Restarts the clock
+         *
+         * \return Time elapsed before the restart, in seconds
+         */
+        auto restart() -> float;
+
+        /**
+         * \brief Measures the time of another group, the elapsed time is restarted
+         *
+         * \param group Group
+         * \param source Time source of the group
+         */
+        void setGroup(TimeSource::Group group, const TimeSource& source=TimeSource::getDefault());
+
+        auto getGroup() const -> TimeSource::Group;
+
+    private:
+        auto getStart() const -> double;
+
+        const TimeSource* m_source;
+        TimeSource::Group m_group;
+        double m_start;
+        std::uint32_t m_epoch;          ///< Epoch of the time source when the clock was started
+    };
+
+}
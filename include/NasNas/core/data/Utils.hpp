@@ -32,7 +32,16 @@ namespace ns::utils {
         std::function<void()> m_on_false;
     };
 
+    /**
+     * \brief Generates a random float in [min, max) using the calling thread generator
+     * \see ns::utils::Random
+     */
     auto getRandomFloat(float min, float max) -> float;
+
+    /**
+     * \brief Generates a random integer in [min, max) using the calling thread generator
+     * \see ns::utils::Random
+     */
     auto getRandomInt(int min, int max) -> int;
 
     /**
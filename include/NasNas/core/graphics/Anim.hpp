@@ -9,10 +9,10 @@
 #include <vector>
 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/System/Clock.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <NasNas/core/data/Rect.hpp>
+#include <NasNas/core/data/TimeSource.hpp>
 
 namespace ns {
 
@@ -148,6 +148,13 @@ namespace ns {
          */
         void setPlaySpeed(float speed);
 
+        /**
+         * \brief Set the group of the TimeSource the AnimPlayer follows, the default group by default
+         *
+         * \param group Group of the default TimeSource, to pause or dilate it with other animations
+         */
+        void setTimeGroup(TimeSource::Group group);
+
         /**
          * \brief Updates the AnimPlayer
          */
@@ -160,7 +167,7 @@ namespace ns {
         int m_index = 0;            ///< Current frame index
         bool m_playing = false;     ///< Is the AnimPlayer playing an Anim ?
         float m_play_speed = 1;     ///< Play speed of the player
-        sf::Clock m_clock;          ///< Clock
+        GameClock m_clock;          ///< Clock
     };
 
 }
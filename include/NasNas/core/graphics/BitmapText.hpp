@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -55,6 +56,13 @@ namespace ns {
 
         auto getFont() const -> const BitmapFont*;
 
+        /**
+         * \brief Get the texture of the text's BitmapFont
+         *
+         * \return Font texture, or nullptr if the text has no font
+         */
+        auto getTexture() const -> const sf::Texture*;
+
         /**
          * \brief Set the font color
          *
@@ -92,6 +100,18 @@ namespace ns {
          */
         auto getGlobalBounds() const -> ns::FloatRect;
 
+        /**
+         * \brief Appends the transformed triangles of the BitmapText to a vertices array
+         *
+         * Used by the RenderQueue to merge the draw calls of drawables sharing a texture.
+         *
+         * \param vertices Array to append the triangles to
+         */
+        void batchTriangles(std::vector<sf::Vertex>& vertices) const;
+
+        /// Opts in to batching, subclasses are drawn with their own `draw` unless they declare it again
+        using Batchable = BitmapText;
+
     private:
         void updateVertices() const;
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <NasNas/core/data/Random.hpp>
+
+namespace ns {
+    struct Particle;
+
+    /**
+     * \brief Declarative description of how a ParticleSystem spawns and updates its particles
+     *
+     * Each field is a module evaluated by the ParticleSystem on all the active particles at once,
+     * without going through the virtual `onParticleCreate` and `onParticleUpdate` hooks.
+     * Speeds, gravity, drag and angular velocity are expressed per second.
+     *
+     * A ParticleEmitter can be loaded from a text file made of `key = value` lines :
+     * \code
+     * # sparks
+     * shape = circle
+     * shape_size = 8 8
+     * speed = 20 60
+     * angle = 200 340
+     * lifetime = 0.5 1.5
+     * gravity = 0 120
+     * drag = 0.5
+     * color_over_life = 0 255 255 255 255
+     * color_over_life = 1 255 128 0 0
+     * scale_over_life = 0 1
+     * scale_over_life = 1 0.2
+     * \endcode
+     * Ranges are written `min max`, curves keys are written `time value` and can be repeated.
+     */
+    struct ParticleEmitter {
+        /**
+         * \brief Piecewise linear curve evaluated over the normalized lifetime of a particle
+         *
+         * \tparam T Type of the values (float or sf::Color)
+         */
+        template <typename T>
+        class Curve {
+        public:
+            /**
+             * \brief Adds a key to the curve, keys are kept sorted by time
+             *
+             * \param time Normalized time of the key, between 0 and 1
+             * \param value Value of the curve at this time
+             */
+            void addKey(float time, const T& value);
+
+            void clear();
+
+            auto empty() const -> bool;
+
+            /**
+             * \brief Evaluates the curve at the given time
+             *
+             * \param time Normalized time, between 0 and 1, NaN gives the first value
+             *
+             * \return Interpolated value
+             */
+            auto evaluate(float time) const -> T;
+
+        private:
+            std::vector<std::pair<float, T>> m_keys;
+        };
+
+        enum class Shape {Point, Rectangle, Circle};
+
+        Shape shape = Shape::Point;                 ///< Shape of the spawn area
+        sf::Vector2f shape_size = {0.f, 0.f};       ///< Size of the spawn rectangle, or radii of the spawn ellipse
+        sf::Vector2f speed = {0.f, 0.f};            ///< Initial speed range in pixels per second
+        sf::Vector2f angle = {0.f, 360.f};          ///< Initial direction range in degrees
+        sf::Vector2f lifetime = {1.f, 1.f};         ///< Lifetime range in seconds, at least 0.1ms
+        sf::Vector2f rotation = {0.f, 0.f};         ///< Initial rotation range in degrees
+        sf::Vector2f angular_velocity = {0.f, 0.f}; ///< Angular velocity range in degrees per second
+        sf::Vector2f scale = {1.f, 1.f};            ///< Initial scale range, ignored if scale_over_life has keys
+        sf::Vector2f gravity = {0.f, 0.f};          ///< Acceleration in pixels per second squared
+        float drag = 0.f;                           ///< Fraction of the velocity lost each second
+        Curve<sf::Color> color_over_life;           ///< Color of the particles during their life
+        Curve<float> scale_over_life;               ///< Scale of the particles during their life
+
+        /**
+         * \brief Loads the emitter description from a text file
+         *
+         * \param filename Path to the file
+         *
+         * \return True if the file was loaded successfully
+         */
+        auto loadFromFile(const std::string& filename) -> bool;
+
+        /**
+         * \brief Loads the emitter description from a string
+         *
+         * \param content Description in the same format as the files
+         *
+         * \return True if the content was parsed successfully
+         */
+        auto loadFromString(const std::string& content) -> bool;
+
+        /**
+         * \brief Initializes a new particle from the spawn modules
+         *
+         * \param particle Particle to initialize
+         * \param dt Duration of an update in seconds
+         * \param random Generator used to pick values in the ranges
+         *
+         * \return Offset of the particle from the ParticleSystem position
+         */
+        auto spawn(Particle& particle, float dt, utils::Random& random) const -> sf::Vector2f;
+
+        /**
+         * \brief Updates a range of particles from the update modules
+         *
+         * \param begin Pointer to the first particle to update
+         * \param end Pointer past the last particle to update
+         * \param dt Duration of an update in seconds
+         */
+        void update(Particle* const* begin, Particle* const* end, float dt) const;
+    };
+
+    template <typename T>
+    void ParticleEmitter::Curve<T>::addKey(float time, const T& value) {
+        auto it = std::upper_bound(m_keys.begin(), m_keys.end(), time,
+            [](float t, const auto& key) { return t < key.first; }
+        );
+        m_keys.emplace(it, time, value);
+    }
+
+    template <typename T>
+    void ParticleEmitter::Curve<T>::clear() {
+        m_keys.clear();
+    }
+
+    template <typename T>
+    auto ParticleEmitter::Curve<T>::empty() const -> bool {
+        return m_keys.empty();
+    }
+
+    namespace detail {
+        inline auto lerp(float a, float b, float x) -> float {
+            return a + (b - a) * x;
+        }
+
+        inline auto lerp(const sf::Color& a, const sf::Color& b, float x) -> sf::Color {
+            return {
+                static_cast<sf::Uint8>(lerp(a.r, b.r, x)),
+                static_cast<sf::Uint8>(lerp(a.g, b.g, x)),
+                static_cast<sf::Uint8>(lerp(a.b, b.b, x)),
+                static_cast<sf::Uint8>(lerp(a.a, b.a, x))
+            };
+        }
+    }
+
+    template <typename T>
+    auto ParticleEmitter::Curve<T>::evaluate(float time) const -> T {
+        // written to be true for NaN
+        if (!(time > m_keys.front().first))
+            return m_keys.front().second;
+        if (time >= m_keys.back().first)
+            return m_keys.back().second;
+        auto next = std::upper_bound(m_keys.begin(), m_keys.end(), time,
+            [](float t, const auto& key) { return t < key.first; }
+        );
+        auto prev = next - 1;
+        auto x = (time - prev->first) / (next->first - prev->first);
+        return detail::lerp(prev->second, next->second, x);
+    }
+
+}
@@ -2,8 +2,9 @@
 
 #pragma once
 
-#include <vector>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Drawable.hpp>
@@ -11,7 +12,9 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <NasNas/core/data/Pools.hpp>
 #include <NasNas/core/data/Rect.hpp>
+#include <NasNas/core/graphics/ParticleEmitter.hpp>
 #include <NasNas/core/graphics/Sprite.hpp>
 #include <NasNas/core/graphics/SpriteBatch.hpp>
 
@@ -24,6 +27,7 @@ namespace ns {
         sf::Vector2f velocity   = {0.f,0.f};
         sf::Color color         = sf::Color::White;
         float lifetime          = 1.f;
+        float angular_velocity  = 0.f;
         auto getAge() const -> float { return age; }
     private:
         friend ParticleSystem;
@@ -49,21 +53,88 @@ namespace ns {
         auto getPosition() const -> sf::Vector2f;
         auto getGlobalBounds() const -> ns::FloatRect;
 
-        virtual void onParticleCreate(Particle& particle) = 0;
-        virtual void onParticleUpdate(Particle& particle) = 0;
+        /**
+         * \brief Enables or disables multithreaded update of the active particles
+         *
+         * When enabled, the active particles are updated in chunks on the default ThreadPool.
+         * `onParticleUpdate` will then be called from multiple threads at once and must only
+         * modify the particle it receives. Particles creation always happens on the calling thread.
+         *
+         * \param value True to update particles in parallel
+         */
+        void setParallel(bool value);
+
+        auto isParallel() const -> bool;
+
+        /**
+         * \brief Sets the ParticleEmitter describing how particles are spawned and updated
+         *
+         * The emitter modules are evaluated on all the particles at once, which is much faster
+         * than overriding `onParticleCreate` and `onParticleUpdate`. The virtual hooks can still be
+         * called after the emitter modules by setting `use_hooks` to true.
+         *
+         * \param emitter Emitter description
+         * \param use_hooks Should `onParticleCreate` and `onParticleUpdate` also be called ?
+         */
+        void setEmitter(const ParticleEmitter& emitter, bool use_hooks=false);
+
+        /**
+         * \brief Get the ParticleEmitter used by the ParticleSystem
+         *
+         * \return Pointer to the emitter, or nullptr if particles are only driven by the virtual hooks
+         */
+        auto getEmitter() const -> const ParticleEmitter*;
+
+        /**
+         * \brief Reseeds the generator used by the ParticleEmitter to spawn particles
+         *
+         * By default, each ParticleSystem is seeded from the generator of the thread constructing it.
+         * Setting the seed makes the emitted particles identical from one run to another.
+         *
+         * \param seed New seed
+         */
+        void setSeed(std::uint64_t seed);
+
+        /**
+         * \brief Called for each particle when it is spawned
+         *
+         * Does nothing by default, override it to customize particles without a ParticleEmitter.
+         *
+         * \param particle Particle being spawned
+         */
+        virtual void onParticleCreate(Particle& /*particle*/) {}
+
+        /**
+         * \brief Called for each active particle on every update
+         *
+         * Does nothing by default, override it to customize particles without a ParticleEmitter.
+         *
+         * \param particle Particle being updated
+         */
+        virtual void onParticleUpdate(Particle& /*particle*/) {}
 
         void update();
 
     private:
-        void updateParticle(Particle& particle, float dt);
+        /// Number of particles updated by a single task when updating in parallel
+        static constexpr std::size_t ParallelChunkSize = 512;
+
+        void createParticle(Particle& particle);
+        void updateParticles(Particle* const* begin, Particle* const* end, float dt);
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
         const sf::Texture* m_texture = nullptr;
         sf::Vector2f m_position;
-        std::vector<std::unique_ptr<Particle>> m_particles;
+        ObjectPool<Particle> m_pool;
+        std::vector<Particle*> m_particles;     ///< Created in m_pool
+        std::vector<Particle*> m_to_update;
         float m_rate = 9999.f;
         float m_to_emmit = 0.f;
         unsigned m_count = 0;
+        bool m_parallel = false;
+        std::optional<ParticleEmitter> m_emitter;
+        utils::Random m_random{utils::Random::get().next()};
+        bool m_use_hooks = true;
         ns::SpriteBatch m_batch;
     };
 
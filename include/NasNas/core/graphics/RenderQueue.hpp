@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+namespace ns {
+
+    /**
+     * \brief List of draw commands sorted and merged before being sent to a RenderTarget
+     *
+     * Commands are drawn by layer order, then in the order they were pushed.
+     * Consecutive batchable commands (drawables made of textured triangles, like ns::Sprite,
+     * ns::BitmapText or ns::ui::NineSlice) using the same texture are merged in a single draw call.
+     *
+     * A layer pushed as unordered lets the queue reorder its commands by texture,
+     * so that all the drawables of the layer sharing a texture are merged.
+     *
+     * A capturing queue copies the triangles of the batchable drawables when they are pushed,
+     * it can then be flushed while the drawables are being modified, on another thread for example.
+     */
+    class RenderQueue {
+    public:
+        /// Function appending the transformed triangles of a batchable drawable to a vertices array
+        using BatchFunction = void(*)(const void*, std::vector<sf::Vertex>&);
+
+        /**
+         * \brief Removes all the commands, to be called at the beginning of a render pass
+         */
+        void clear();
+
+        /**
+         * \brief Copies the triangles of the batchable drawables when they are pushed instead of when flushing
+         *
+         * \param value True to enable capture
+         */
+        void setCapturing(bool value);
+
+        auto isCapturing() const -> bool;
+
+        /**
+         * \brief Pushes a command drawing a drawable with the render states of the pass
+         *
+         * \param layer Order of the layer the drawable belongs to
+         * \param drawable Drawable to draw
+         * \param unordered True if the drawable can be reordered inside its layer
+         * \param offset Translation applied to the drawable
+         */
+        void push(std::uint16_t layer, const sf::Drawable* drawable, bool unordered=false, const sf::Vector2f& offset={});
+
+        /**
+         * \brief Pushes a command drawing a batchable drawable
+         *
+         * \param layer Order of the layer the drawable belongs to
+         * \param drawable Drawable to draw
+         * \param object Object given to the batch function
+         * \param batch Function appending the drawable triangles
+         * \param texture Texture used by the drawable
+         * \param unordered True if the drawable can be reordered inside its layer
+         * \param offset Translation applied to the drawable
+         */
+        void push(std::uint16_t layer, const sf::Drawable* drawable, const void* object, BatchFunction batch, const sf::Texture* texture,
+                  bool unordered=false, const sf::Vector2f& offset={});
+
+        /**
+         * \brief Sorts the commands and draws them
+         *
+         * \param target Target to draw on
+         * \param states Render states of the pass, the texture is set by the commands
+         */
+        void flush(sf::RenderTarget& target, const sf::RenderStates& states);
+
+        auto getCommandsCount() const -> std::size_t;
+
+        /**
+         * \brief Get the number of commands that read their drawable when flushing
+         *
+         * In a capturing queue, these are the non batchable drawables.
+         */
+        auto getLiveCommandsCount() const -> std::size_t;
+
+        /**
+         * \brief Get the number of draw calls made by the last flush
+         */
+        auto getDrawCallsCount() const -> std::size_t;
+
+    private:
+        struct Command {
+            std::uint64_t key;
+            const sf::Drawable* drawable;
+            const void* object;
+            BatchFunction batch;
+            const sf::Texture* texture;
+            sf::Vector2f offset;
+            std::uint32_t first;        ///< Range of the captured triangles in m_captured
+            std::uint32_t count;
+            bool captured;
+        };
+
+        auto makeKey(std::uint16_t layer, const sf::Texture* texture, bool unordered) -> std::uint64_t;
+        void drawBatch(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Texture* texture);
+        static void translate(std::vector<sf::Vertex>& vertices, std::size_t first, const sf::Vector2f& offset);
+
+        std::vector<Command> m_commands;
+        std::vector<sf::Vertex> m_vertices;
+        std::vector<sf::Vertex> m_captured;
+        bool m_capturing = false;
+        std::size_t m_live_commands = 0;
+        std::unordered_map<const sf::Texture*, std::uint16_t> m_texture_ranks;
+        std::size_t m_draw_calls = 0;
+    };
+
+}
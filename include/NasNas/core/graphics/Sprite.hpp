@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Sprite.hpp>
@@ -36,6 +38,18 @@ class Sprite : public sf::Drawable, public sf::Transformable {
         auto getLocalBounds() const -> ns::FloatRect;
         auto getGlobalBounds() const -> ns::FloatRect;
 
+        /**
+         * \brief Appends the transformed triangles of the Sprite to a vertices array
+         *
+         * Used by the RenderQueue to merge the draw calls of drawables sharing a texture.
+         *
+         * \param vertices Array to append the triangles to
+         */
+        void batchTriangles(std::vector<sf::Vertex>& vertices) const;
+
+        /// Opts in to batching, subclasses are drawn with their own `draw` unless they declare it again
+        using Batchable = Sprite;
+
     private:
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
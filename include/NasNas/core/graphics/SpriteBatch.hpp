@@ -16,6 +16,7 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
 
+#include <NasNas/core/data/Pools.hpp>
 #include <NasNas/core/graphics/Renderable.hpp>
 #include <NasNas/core/graphics/Sprite.hpp>
 
@@ -42,6 +43,14 @@ namespace ns {
         void setDrawOrder(DrawOrder order);
 
         void draw(const ns::Sprite* sprite);
+
+        /**
+         * \brief Draws a transient sprite, created by the SpriteBatch from a texture rect
+         *
+         * Transient sprites are drawn until the next frame : the first transient draw after
+         * the SpriteBatch was rendered replaces all the transient sprites of the previous frame.
+         * Their memory is reused from frame to frame.
+         */
         void draw(const sf::Texture* texture, const sf::Vector2f& pos, const sf::IntRect& rect, const sf::Color& color = sf::Color::White);
         void draw(const sf::Texture* texture, const sf::IntRect& rect, const sf::Transformable& tr, const sf::Color& color = sf::Color::White);
 
@@ -54,8 +63,20 @@ namespace ns {
         auto getPosition() const -> sf::Vector2f;
         auto getGlobalBounds() const -> ns::FloatRect;
 
-    private:
+        /**
+         * \brief Generates the vertices of the sprites and updates the bounds of the SpriteBatch
+         *
+         * Called by the App before drawing each frame. In headless mode, the vertices are
+         * generated but not uploaded to the GPU.
+         */
         void render() override;
+
+    private:
+        /// Number of sprites handled by a single task when generating vertices in parallel
+        static constexpr std::size_t ParallelChunkSize = 1024;
+
+        static auto renderSprites(SpriteBatchLayer& layer, std::size_t begin, std::size_t end) -> ns::FloatRect;
+        auto createTransient(const sf::Texture& texture, const sf::IntRect& rect, const sf::Color& color) -> ns::Sprite*;
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
         ns::FloatRect m_global_bounds;
@@ -63,7 +84,8 @@ namespace ns {
         DrawOrder m_draw_order = DrawOrder::Front;
 
         std::list<SpriteBatchLayer> m_layers;
-        std::vector<std::unique_ptr<const ns::Sprite>> m_gc;
+        FrameArena<ns::Sprite> m_transients;
+        bool m_transients_rendered = false;     ///< The current transient sprites were rendered, the next transient draw starts a new frame
 
         bool m_need_end = false;
         bool m_need_render = false;
@@ -5,10 +5,12 @@
 #include <NasNas/ecs/components/InputsComponent.hpp>
 #include <NasNas/ecs/components/PhysicsComponent.hpp>
 #include <NasNas/ecs/components/SpriteComponent.hpp>
+#include <NasNas/ecs/components/TransformComponent.hpp>
 #include <NasNas/ecs/System.hpp>
 
 namespace ns::ecs {
     extern System<InputsComponent> inputs_system;
     extern System<PhysicsComponent> physics_system;
     extern System<SpriteComponent> sprite_system;
+    extern System<TransformComponent> interpolation_system;  ///< Saves the previous state of the Transforms
 }
@@ -15,6 +15,30 @@ namespace ns::ecs {
 
         void setScaleX(float x);
         void setScaleY(float y);
+
+        /**
+         * \brief Stores the current position, rotation and scale as the previous state
+         *
+         * Run `interpolation_system` at the beginning of each update to do it for all the Transforms.
+         */
+        void savePreviousState();
+
+        /**
+         * \brief Get the transform between the previous state and the current one
+         *
+         * The current transform is returned until the previous state is saved for the first time.
+         *
+         * \param alpha Interpolation factor, see App::getInterpolation
+         *
+         * \return Interpolated transform
+         */
+        auto getInterpolatedTransform(float alpha) const -> sf::Transform;
+
+    private:
+        sf::Vector2f m_previous_position;
+        float m_previous_rotation = 0.f;
+        sf::Vector2f m_previous_scale = {1.f, 1.f};
+        bool m_has_previous_state = false;
     };
 
     using Transform = TransformComponent;
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <NasNas/reslib/RawTexture.hpp>
+
+namespace ns {
+    class Dir;
+
+    /**
+     * \brief Handle on resources loading in the background
+     *
+     * Images are decoded, raw textures are read and fonts are loaded on the default ThreadPool. Textures can only be
+     * uploaded to the GPU from the thread owning the OpenGL context, so `update` has to be called
+     * regularly from the main thread (once per frame on a loading screen for example).
+     * The resources being loaded can be accessed from their Dir, but their content is only valid
+     * once the task is done.
+     */
+    class LoadingTask {
+    public:
+        /// Called with the number of resources loaded and the total number of resources to load
+        using ProgressCallback = std::function<void(std::size_t, std::size_t)>;
+
+        LoadingTask() = default;
+
+        /**
+         * \brief Waits for the resources being decoded, the textures not uploaded yet stay empty
+         */
+        ~LoadingTask();
+
+        LoadingTask(LoadingTask&&) = default;
+        LoadingTask& operator=(LoadingTask&& other) noexcept;
+
+        /**
+         * \brief Set the function called each time resources finish loading, on the thread calling `update`
+         *
+         * \param callback Progress callback
+         */
+        void onProgress(ProgressCallback callback);
+
+        /**
+         * \brief Uploads the textures decoded since the previous call and updates the progress
+         *
+         * Must be called from the thread owning the OpenGL context. In headless mode, the
+         * images are decoded but never uploaded.
+         *
+         * \param max_uploads Maximum number of textures uploaded by this call, to spread the uploads over several frames
+         *
+         * \return True if all the resources are loaded
+         */
+        auto update(std::size_t max_uploads=std::numeric_limits<std::size_t>::max()) -> bool;
+
+        /**
+         * \brief Blocks until all the resources are loaded, uploading the textures as soon as they are decoded
+         */
+        void wait();
+
+        auto isDone() const -> bool;
+
+        auto getLoadedCount() const -> std::size_t;
+
+        auto getTotalCount() const -> std::size_t;
+
+        /**
+         * \brief Get the loading progress
+         *
+         * \return Ratio of loaded resources, between 0 and 1
+         */
+        auto getProgress() const -> float;
+
+        /**
+         * \brief Get the number of files that could not be loaded, their resource stays empty
+         */
+        auto getFailedCount() const -> std::size_t;
+
+    private:
+        friend Dir;
+
+        /// Called on the thread calling `update` to fill the texture, empty if the file could not be read
+        using Upload = std::function<bool(sf::Texture&)>;
+
+        struct TextureEntry {
+            sf::Texture* texture;
+            std::future<Upload> decoded;
+        };
+        struct FontEntry {
+            std::future<bool> loaded;
+        };
+
+        /// `decode` is called on a worker thread to fill the image uploaded to the texture
+        void addTexture(sf::Texture& texture, std::function<bool(sf::Image&)> decode);
+        /// `read` is called on a worker thread to read the raw texture uploaded to the texture
+        void addRawTexture(sf::Texture& texture, std::function<bool(RawTexture&)> read);
+        /// `load` is called on a worker thread
+        void addFont(std::function<bool()> load);
+        void notify();
+        void join();
+
+        std::vector<TextureEntry> m_textures;
+        std::vector<FontEntry> m_fonts;
+        std::vector<std::size_t> m_pending_textures;    ///< Indices of the textures not uploaded yet
+        std::vector<std::size_t> m_pending_fonts;
+        std::size_t m_loaded = 0;
+        std::size_t m_failed = 0;
+        ProgressCallback m_on_progress;
+    };
+
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns {
+
+    /**
+     * \brief Read only archive of assets, memory mapped
+     *
+     * A pack is made of a header, an index of the files, then the content of the files, each aligned
+     * on `Pack::Alignment` bytes. Entries can be stored as is or compressed; stored entries are accessed
+     * directly in the mapped file. Compressed entries read with `getData` are decompressed on first access
+     * and kept in memory until the pack is closed, for resources reading their data as long as they live
+     * (fonts). Entries read with `readData` are decompressed in a buffer owned by the caller, freed once the
+     * resource is created (textures).
+     *
+     * Packs are built from a directory with `Pack::build` or with the `NasNas_pack` tool. `Res::load`
+     * loads a pack instead of a directory when given a pack file, or when the directory does not exist
+     * but a pack with the same name does.
+     *
+     * File format (little endian) :
+     *   - header : "NSPK", version (u32), entries count (u32), index size in bytes (u32)
+     *   - index : for each entry, offset (u64), size (u64), stored size (u64), compression (u32),
+     *     path length (u32), path relative to the packed directory, separated with '/'
+     *   - data : entries content, at offset from the beginning of the file
+     */
+    class Pack {
+    public:
+        static constexpr const char* Extension = ".nspack";
+        static constexpr std::uint32_t Version = 1;
+        static constexpr std::size_t Alignment = 16;
+
+        enum class Compression : std::uint32_t {
+            None = 0,
+            LZ = 1      ///< LZ77 byte oriented compression, fast to decompress
+        };
+
+        struct Entry {
+            std::string path;
+            std::uint64_t offset = 0;
+            std::uint64_t size = 0;             ///< Size of the file content
+            std::uint64_t stored_size = 0;      ///< Size of the data stored in the pack
+            Compression compression = Compression::None;
+        };
+
+        struct Data {
+            const void* data = nullptr;
+            std::size_t size = 0;
+        };
+
+        struct Buffer {
+            Data data;
+            std::unique_ptr<char[]> storage;    ///< Decompressed content, null if the data is in the mapped file
+        };
+
+        Pack();
+        ~Pack();
+        Pack(const Pack&) = delete;
+        Pack& operator=(const Pack&) = delete;
+
+        /**
+         * \brief Maps a pack file in memory and reads its index
+         *
+         * \param filename Path to the pack file
+         *
+         * \return True if the pack was opened
+         */
+        auto open(const std::string& filename) -> bool;
+
+        /**
+         * \brief Unmaps the pack file, the data returned by `getData` is no longer valid
+         */
+        void close();
+
+        auto isOpen() const -> bool;
+
+        auto getFilename() const -> const std::string&;
+
+        auto getEntries() const -> const std::vector<Entry>&;
+
+        /**
+         * \brief Find an entry from its path in the pack
+         *
+         * \param path Path relative to the packed directory
+         *
+         * \return The entry, or nullptr if the pack does not have this file
+         */
+        auto find(const std::string& path) const -> const Entry*;
+
+        /**
+         * \brief Get the content of an entry, without copy if it is not compressed
+         *
+         * A compressed entry stays in memory until the pack is closed. Can be called from several threads.
+         *
+         * \param entry Entry of this pack
+         *
+         * \return Content of the file, or an empty Data if it could not be decompressed
+         */
+        auto getData(const Entry& entry) const -> Data;
+
+        /**
+         * \brief Get the content of an entry, decompressed in a buffer owned by the caller if it is compressed
+         *
+         * Can be called from several threads.
+         *
+         * \param entry Entry of this pack
+         *
+         * \return Content of the file, or an empty Buffer if it could not be decompressed
+         */
+        auto readData(const Entry& entry) const -> Buffer;
+
+        /**
+         * \brief Packs all the files of a directory and its sub directories
+         *
+         * Files already compressed (png, jpg) are stored as is, other files are compressed
+         * when it reduces their size.
+         *
+         * \param directory Directory to pack
+         * \param filename Path of the pack file to write
+         * \param compress Try to compress the entries
+         *
+         * \return True if the pack was written
+         */
+        static auto build(const std::string& directory, const std::string& filename, bool compress=true) -> bool;
+
+    private:
+        auto map(const std::string& filename) -> bool;
+        void unmap();
+        auto readIndex() -> bool;
+
+        std::string m_filename;
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+        void* m_mapping = nullptr;                  ///< Platform handle of the mapping
+        std::unique_ptr<char[]> m_buffer;           ///< File content when it can not be mapped
+        std::vector<Entry> m_entries;
+        std::unordered_map<std::string, std::size_t> m_index;
+        mutable std::mutex m_mutex;
+        mutable std::unordered_map<const Entry*, std::unique_ptr<char[]>> m_decompressed;
+    };
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace ns {
+
+    /**
+     * \brief Texture pixels decoded offline, uploaded without image decoding
+     *
+     * Raw textures are converted from images with `RawTexture::convert` or with the `NasNas_texture` tool.
+     * The file of an image `name.png` converted is `name.png.nstex`, the ResourceManager loads it instead
+     * of the image under the name of the image, so game code does not change. Raw textures are read
+     * from a pack without copy when their entry is not compressed.
+     *
+     * sf::Texture always stores RGBA8 pixels, the pixels are stored in this format and uploaded as is.
+     *
+     * File format (little endian) :
+     *   - header (32 bytes) : "NSTX", version (u32), width (u32), height (u32), flags (u32), 12 reserved bytes
+     *   - pixels : width * height RGBA8 pixels, rows from top to bottom
+     */
+    class RawTexture {
+    public:
+        static constexpr const char* Extension = ".nstex";
+        static constexpr std::uint32_t Version = 1;
+        static constexpr std::size_t HeaderSize = 32;
+
+        enum Flags : std::uint32_t {
+            None = 0,
+            Smooth = 1u << 0,      ///< The texture is smoothed
+            Mipmap = 1u << 1       ///< Mipmaps are generated on upload, for textures drawn downscaled
+        };
+
+        RawTexture() = default;
+        RawTexture(const RawTexture&) = delete;
+        RawTexture(RawTexture&&) = default;
+        RawTexture& operator=(const RawTexture&) = delete;
+        RawTexture& operator=(RawTexture&&) = default;
+
+        /**
+         * \brief Reads a raw texture file
+         *
+         * \param filename Path to the file
+         *
+         * \return True if the file is a valid raw texture
+         */
+        auto loadFromFile(const std::string& filename) -> bool;
+
+        /**
+         * \brief Reads a raw texture from memory, without copy : the data must stay valid until the upload
+         *
+         * \param data Content of a raw texture file
+         * \param size Size of the data in bytes
+         *
+         * \return True if the data is a valid raw texture
+         */
+        auto loadFromMemory(const void* data, std::size_t size) -> bool;
+
+        /**
+         * \brief Reads a raw texture from memory and keeps the memory, to free it with the raw texture after the upload
+         *
+         * \param data Content of a raw texture file
+         * \param size Size of the data in bytes
+         *
+         * \return True if the data is a valid raw texture
+         */
+        auto loadFromMemory(std::unique_ptr<char[]> data, std::size_t size) -> bool;
+
+        auto getSize() const -> sf::Vector2u;
+
+        auto getFlags() const -> std::uint32_t;
+
+        auto getPixels() const -> const std::uint8_t*;
+
+        /**
+         * \brief Uploads the pixels to a texture, from the thread owning the OpenGL context
+         *
+         * \param texture Texture to fill, it is resized to the raw texture size
+         *
+         * \return True if the texture was created
+         */
+        auto upload(sf::Texture& texture) const -> bool;
+
+        /**
+         * \brief Writes the pixels of an image in a raw texture file
+         *
+         * \param image Image to convert
+         * \param filename Path of the raw texture file
+         * \param flags Combination of RawTexture::Flags
+         *
+         * \return True if the file was written
+         */
+        static auto convert(const sf::Image& image, const std::string& filename, std::uint32_t flags=None) -> bool;
+
+        /**
+         * \brief Get the name of the texture loaded from a raw texture file : its name without the raw
+         * texture extension if it was converted from an image, its name otherwise
+         *
+         * \param file_name Raw texture file name or path
+         */
+        static auto getTextureName(const std::string& file_name) -> std::string;
+
+    private:
+        std::vector<std::uint8_t> m_buffer;             ///< Content of the file, when not read from memory
+        std::unique_ptr<char[]> m_storage;              ///< Memory given to `loadFromMemory`
+        const std::uint8_t* m_pixels = nullptr;
+        sf::Vector2u m_size;
+        std::uint32_t m_flags = None;
+    };
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <NasNas/reslib/ResourceIndex.hpp>
+
+namespace ns {
+
+    /**
+     * \brief Reference counted handle on a texture or a font of the ResourceManager
+     *
+     * A resource referenced by at least one handle is never evicted from the cache when the
+     * memory budget is exceeded. Get handles with `Res::acquireTexture` and `Res::acquireFont`.
+     * Handles kept after the ResourceManager is loaded again are invalid.
+     *
+     * \tparam T sf::Texture or sf::Font
+     */
+    template <typename T>
+    class ResourceHandle {
+    public:
+        ResourceHandle() = default;
+        ResourceHandle(const ResourceHandle& other);
+        ResourceHandle(ResourceHandle&& other) noexcept;
+        ResourceHandle& operator=(const ResourceHandle& other);
+        ResourceHandle& operator=(ResourceHandle&& other) noexcept;
+        ~ResourceHandle();
+
+        /**
+         * \brief Get the resource, reloaded if it was evicted
+         */
+        auto get() const -> T&;
+        auto operator*() const -> T&;
+        auto operator->() const -> T*;
+
+        auto getId() const -> ResourceId;
+
+        auto isValid() const -> bool;
+
+        /**
+         * \brief Releases the resource, it can be evicted once it has no handle
+         */
+        void reset();
+
+    private:
+        friend ResourceManager;
+        explicit ResourceHandle(ResourceId id);
+
+        ResourceId m_id;
+    };
+
+    using TextureHandle = ResourceHandle<sf::Texture>;
+    using FontHandle = ResourceHandle<sf::Font>;
+
+}
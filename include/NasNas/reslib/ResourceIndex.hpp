@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace ns {
+    class Dir;
+    class ResourceManager;
+    template <typename T>
+    class ResourceHandle;
+
+    /**
+     * \brief Interned path of a resource, gives access to the resource without path resolution
+     *
+     * Get it once with `Res::getId` and keep it instead of the path in hot code.
+     * An id is only valid until the ResourceManager is loaded again or disposed.
+     */
+    class ResourceId {
+    public:
+        ResourceId() = default;
+
+        auto isValid() const -> bool;
+
+        auto operator==(const ResourceId& other) const -> bool;
+        auto operator!=(const ResourceId& other) const -> bool;
+
+    private:
+        friend ResourceManager;
+        template <typename T>
+        friend class ResourceHandle;
+        static constexpr std::uint32_t Invalid = std::numeric_limits<std::uint32_t>::max();
+
+        ResourceId(std::uint32_t index, std::uint32_t generation);
+
+        std::uint32_t m_index = Invalid;
+        std::uint32_t m_generation = 0;
+    };
+
+    /**
+     * \brief Flat hash table from the full path of the resources to their slot, built by the ResourceManager on load
+     *
+     * Lookups are done on string views, without allocation.
+     */
+    class ResourceIndex {
+    public:
+        static constexpr std::uint32_t NotFound = std::numeric_limits<std::uint32_t>::max();
+
+        enum class Type : std::uint8_t {
+            Texture,
+            Font
+        };
+
+        struct Slot {
+            std::string path;                   ///< Path relative to the root directory
+            Type type;
+            Dir* dir;                           ///< Directory owning the resource
+            std::unique_ptr<sf::Texture>* texture = nullptr;
+            std::unique_ptr<sf::Font>* font = nullptr;
+            std::uint32_t refs = 0;             ///< Number of handles on the resource, it is not evicted while referenced
+            std::uint64_t last_use = 0;         ///< Last access, for LRU eviction
+            std::size_t bytes = 0;              ///< Resident memory at the last memory count
+            auto getName() const -> std::string;
+        };
+
+        void clear();
+
+        /**
+         * \brief Adds a resource to the index, its path must not be already in the index
+         *
+         * \return Index of the slot
+         */
+        auto add(Slot slot) -> std::uint32_t;
+
+        /**
+         * \brief Find the slot of a resource from its path relative to the root directory
+         *
+         * \return Index of the slot, or NotFound
+         */
+        auto find(std::string_view path) const -> std::uint32_t;
+
+        auto get(std::uint32_t index) -> Slot&;
+
+        auto size() const -> std::size_t;
+
+    private:
+        static auto hash(std::string_view path) -> std::uint64_t;
+        void rehash(std::size_t buckets_count);
+
+        std::vector<Slot> m_slots;
+        std::vector<std::uint64_t> m_hashes;            ///< Hash of the path of each slot
+        std::vector<std::uint32_t> m_buckets;           ///< Open addressing table of slots indices, power of two size
+    };
+
+}
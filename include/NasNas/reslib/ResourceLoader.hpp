@@ -13,13 +13,40 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <NasNas/reslib/LoadingTask.hpp>
+#include <NasNas/reslib/Pack.hpp>
+#include <NasNas/reslib/RawTexture.hpp>
+
 namespace ns {
+    class ResourceManager;
 
     class Dir {
     public:
-        Dir(std::string  name, Dir* parent);
+        /**
+         * \brief Constructs an empty directory
+         *
+         * \param name Directory name
+         * \param parent Parent directory, nullptr for the root directory
+         * \param pack Pack the resources are read from, the sub directories use the pack of their parent
+         */
+        Dir(std::string  name, Dir* parent, const Pack* pack=nullptr);
         ~Dir();
+
+        /**
+         * \brief Builds the directory tree, from the file system or from the pack of this Dir
+         *
+         * \param path Path of the directory, unused when reading from a pack
+         * \param autoload Load all the resources now, otherwise they are loaded on first access
+         */
         void load(const std::string& path, bool autoload);
+
+        /**
+         * \brief Starts loading the textures and fonts of this Dir and its sub directories not loaded yet
+         *
+         * \param task Task the resources are added to
+         */
+        void loadAll(LoadingTask& task);
+
         auto in(const std::string& dir_name) -> Dir&;
         auto getName() -> const std::string&;
         auto getPath() -> std::string;
@@ -28,14 +55,30 @@ namespace ns {
         void printTree(int indent=0);
 
     private:
+        friend ResourceManager;
         static const std::set<std::string> texture_extensions;
         static const std::set<std::string> fonts_extensions;
 
+        void scan(const std::string& path);
+        void addPacked(const std::string& path, const Pack::Entry& entry);
+        void addTextureFile(const std::string& file_name, const Pack::Entry* entry);
+        auto takeTexture(const std::string& texture_name) -> std::unique_ptr<sf::Texture>;
+        auto takeFont(const std::string& font_name) -> std::unique_ptr<sf::Font>;
+        void evictTexture(const std::string& texture_name);
+        void evictFont(const std::string& font_name);
+        auto getFileSize(const std::string& file_name) -> std::size_t;
+
         Dir* m_parent;
         std::string m_name;
+        const Pack* m_pack;
+        std::unordered_map<std::string, const Pack::Entry*> m_packed;     ///< Pack entries of the files of this Dir
+        std::unordered_map<std::string, std::string> m_raw_files;         ///< Raw texture files loaded instead of the textures images
         std::unordered_map<std::string, std::unique_ptr<Dir>> m_dirs;
         std::unordered_map<std::string, std::unique_ptr<sf::Texture>> m_textures;
         std::unordered_map<std::string, std::unique_ptr<sf::Font>> m_fonts;
+        // evicted resources are emptied but kept alive, pointers to them stay valid and they are reloaded in place
+        std::unordered_map<std::string, std::unique_ptr<sf::Texture>> m_evicted_textures;
+        std::unordered_map<std::string, std::unique_ptr<sf::Font>> m_evicted_fonts;
     };
 
 }
@@ -5,36 +5,167 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
+#include <NasNas/reslib/ResourceHandle.hpp>
+#include <NasNas/reslib/ResourceIndex.hpp>
 #include <NasNas/reslib/ResourceLoader.hpp>
 
 namespace ns {
 
     class ResourceManager {
     public:
+        struct Stats {
+            std::size_t textures = 0;           ///< Resident textures
+            std::size_t textures_bytes = 0;     ///< GPU memory used by the resident textures, 4 bytes per pixel
+            std::size_t fonts = 0;              ///< Resident fonts
+            std::size_t fonts_bytes = 0;        ///< CPU memory used by the resident fonts, the size of their file
+            std::size_t evictions = 0;          ///< Resources evicted since the last load
+        };
+
+        /**
+         * \brief Loads the assets directory tree
+         *
+         * `assets_directory_name` can also be a pack file (see ns::Pack). If the directory does not
+         * exist but a pack with the same name and the Pack::Extension does, the pack is loaded instead.
+         * Resources paths are the same for a pack and for its directory.
+         *
+         * With the `hot_reload` AppConfig, the textures and fonts of the directory are reloaded in place
+         * when their file changes : references to them stay valid. Files are decoded on the default ThreadPool.
+         *
+         * \param assets_directory_name Assets root directory, or pack file
+         * \param autoload Load all the resources now, otherwise they are loaded on first access
+         *
+         * \return True if the directory or the pack was loaded
+         */
         static auto load(const std::string& assets_directory_name, bool autoload=true) -> bool;
+
+        /**
+         * \brief Loads the directory tree, then loads all the textures and fonts in the background
+         *
+         * Images are decoded in parallel on the default ThreadPool, the returned task uploads them
+         * when updated. The resources can be accessed right away but they are empty until the task is done.
+         * The ResourceManager must not be loaded again or disposed while the task is running.
+         *
+         * \param assets_directory_name Assets root directory
+         * \param callback Function called with the progress of the loading, see LoadingTask::onProgress
+         *
+         * \return The loading task, already done if the directory was not found
+         */
+        static auto loadAsync(const std::string& assets_directory_name, LoadingTask::ProgressCallback callback={}) -> LoadingTask;
+
         static void dispose();
         static auto in(const std::string& dir_name) -> Dir&;
 
         static auto getName() -> const std::string& ;
         static auto getTexture(const std::string& texture_path) -> sf::Texture&;
         static auto getFont(const std::string& font_path) -> sf::Font&;
+
+        /**
+         * \brief Get the interned id of a resource, to access it without resolving its path again
+         *
+         * \param path Path of the texture or font, with or without the root directory name
+         *
+         * \return The id of the resource, or an invalid id if there is no resource at this path
+         */
+        static auto getId(const std::string& path) -> ResourceId;
+
+        /**
+         * \brief Get a texture from its id, in constant time and without allocation once loaded
+         *
+         * \param id Id of a texture, returned by `getId` since the last load
+         */
+        static auto getTexture(ResourceId id) -> sf::Texture&;
+
+        /**
+         * \brief Get a font from its id, in constant time and without allocation once loaded
+         *
+         * \param id Id of a font, returned by `getId` since the last load
+         */
+        static auto getFont(ResourceId id) -> sf::Font&;
+
+        /**
+         * \brief Get a reference counted handle on a texture, the texture is not evicted while it has handles
+         *
+         * \param texture_path Path of the texture, with or without the root directory name
+         */
+        static auto acquireTexture(const std::string& texture_path) -> TextureHandle;
+        static auto acquireTexture(ResourceId id) -> TextureHandle;
+
+        /**
+         * \brief Get a reference counted handle on a font, the font is not evicted while it has handles
+         *
+         * \param font_path Path of the font, with or without the root directory name
+         */
+        static auto acquireFont(const std::string& font_path) -> FontHandle;
+        static auto acquireFont(ResourceId id) -> FontHandle;
+
+        /**
+         * \brief Set the memory the resident resources can use, no limit by default
+         *
+         * When a resource loaded through the ResourceManager exceeds the budget, the least recently used
+         * resources without handle are evicted until the budget is met. Evicted resources are emptied, not
+         * destroyed : references to them stay valid, and they are reloaded in place on their next access
+         * through the ResourceManager. Keep handles on the resources used without going through the
+         * ResourceManager each frame (for example the texture of a Sprite).
+         *
+         * \param gpu_bytes Budget of the textures
+         * \param cpu_bytes Budget of the fonts
+         */
+        static void setMemoryBudget(std::size_t gpu_bytes, std::size_t cpu_bytes=std::numeric_limits<std::size_t>::max());
+
+        /**
+         * \brief Evicts the least recently used resources without handle until the memory budget is met
+         */
+        static void trim();
+
+        /**
+         * \brief Counts the resident resources and the memory they use
+         */
+        static auto getStats() -> Stats;
+
         static void printTree();
 
     private:
+        template <typename T>
+        friend class ResourceHandle;
+
         static Dir* m_data;
+        static Pack m_pack;
+        static ResourceIndex m_index;
+        static std::uint32_t m_generation;      ///< Incremented on each load, ids of previous loads are invalid
+        static std::uint64_t m_clock;           ///< Incremented on each access by id, for LRU eviction
+        static std::size_t m_gpu_budget;
+        static std::size_t m_cpu_budget;
+        static std::size_t m_evictions;
+        static std::size_t m_watch;             ///< FileWatcher id of the assets directory, 0 if not watched
+        static std::string m_watch_root;
         static bool m_ready;
         static std::string m_root_dir_name;
 
         ResourceManager();
         ~ResourceManager();
         static void checkReady();
+        static auto openPack(const std::string& name) -> bool;
         static auto resolvePath(const std::string& p) -> std::pair<Dir*, std::string>;
+        static void buildIndex(Dir& dir, const std::string& prefix);
+        static auto findSlot(std::string_view path) -> std::uint32_t;
+        static auto getSlot(ResourceId id, ResourceIndex::Type type) -> ResourceIndex::Slot&;
+        static void retain(ResourceId id);
+        static void release(ResourceId id);
+        static auto countMemory() -> Stats;
+        static void enforceBudget(std::uint32_t keep);
+        static void evict(ResourceIndex::Type type, std::size_t used, std::size_t budget, std::uint32_t keep);
+        static void watch(const std::string& path);
+        static void unwatch();
+        static auto findWatchedSlot(const std::string& file) -> ResourceIndex::Slot*;
     };
 
     typedef ResourceManager Res;
@@ -31,6 +31,8 @@ namespace ns::tm {
 
     public:
         LayersContainer() = default;
+        LayersContainer(LayersContainer&&) = default;
+        LayersContainer& operator=(LayersContainer&&) = default;
         virtual ~LayersContainer() = default;
 
         auto hasLayer(const std::string& name) const -> bool;
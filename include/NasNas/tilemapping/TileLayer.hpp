@@ -14,9 +14,9 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
-#include <SFML/System/Clock.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <NasNas/core/data/TimeSource.hpp>
 #include <NasNas/core/graphics/Renderable.hpp>
 #include <NasNas/tilemapping/Layer.hpp>
 #include <NasNas/tilemapping/Tile.hpp>
@@ -29,7 +29,7 @@ namespace ns::tm {
 
         struct AnimatedTileInfo {
             unsigned int index;
-            sf::Clock clock;
+            GameClock clock;
             std::vector<sf::Vector2u> positions;
         };
 
@@ -42,12 +42,20 @@ namespace ns::tm {
 
         void update();
 
+        /**
+         * \brief Set the group of the TimeSource the animated tiles follow, the default group by default
+         *
+         * \param group Group of the default TimeSource, to pause or dilate it with other animations
+         */
+        void setTimeGroup(TimeSource::Group group);
+
     private:
         int m_width;
         int m_height;
 
         std::vector<std::optional<Tile>> m_tiles;
         std::map<std::uint32_t, AnimatedTileInfo> m_animated_tiles_pos;
+        TimeSource::Group m_time_group = TimeSource::DefaultGroup;
         std::unordered_map<const Tileset*, sf::VertexArray> m_vertices;
         sf::RenderTexture m_render_texture;
         sf::Sprite m_sprite;
@@ -5,6 +5,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,10 +26,40 @@ namespace ns::tm {
     class TiledMap : public LayersContainer, public PropertiesContainer {
     public:
         TiledMap();
-
+        ~TiledMap() override;
+
+        /**
+         * \brief Loads a TMX file
+         *
+         * With the `hot_reload` AppConfig, the map is reloaded when the TMX file or one of its TSX files changes.
+         * The files are parsed on the default ThreadPool, the map is rebuilt on the thread updating the App.
+         *
+         * \param file_name Path of the TMX file
+         *
+         * \return True if the file was parsed
+         */
         auto loadFromFile(const std::string& file_name) -> bool;
         auto loadFromString(const std::string& data) -> bool;
 
+        /**
+         * \brief Loads the TMX file again, replacing the layers and tilesets
+         *
+         * Layers references must be taken again from the map after a reload, from the `onReload` callback.
+         * The previous layers are kept alive until the next reload, so drawables still using them stay valid
+         * until the callback replaced them.
+         * If the file can not be parsed, the map is left unchanged.
+         *
+         * \return True if the file was reloaded
+         */
+        auto reload() -> bool;
+
+        /**
+         * \brief Set the function called after each reload of the map
+         *
+         * \param callback Function called after a reload
+         */
+        void onReload(std::function<void()> callback);
+
         auto getTMXFilePath() const -> const std::string&;
 
         auto getSize() const -> const sf::Vector2f&;
@@ -41,7 +74,17 @@ namespace ns::tm {
         void update();
 
     private:
+        struct PreviousLoad {
+            LayersContainer layers;
+            std::vector<Tileset> tilesets;
+            std::vector<TilesetData> tilesets_data;
+        };
+
+        static auto parseFile(const std::string& file_name, pugi::xml_document& xml) -> bool;
         void load(const pugi::xml_document& xml);
+        void replace(const pugi::xml_document& xml);
+        void watchFiles();
+        void unwatchFiles();
 
         std::string m_file_name;
         std::string m_file_relative_path;
@@ -54,6 +97,11 @@ namespace ns::tm {
         std::vector<TilesetData> m_tilesets_data;
 
         const Camera* m_camera = nullptr;
+
+        std::vector<std::string> m_tsx_files;
+        std::vector<std::size_t> m_watches;                         ///< FileWatcher ids of the TMX and TSX files
+        std::unique_ptr<PreviousLoad> m_previous_load;               ///< Layers and tilesets replaced by the last reload
+        std::function<void()> m_on_reload;
     };
 
 }
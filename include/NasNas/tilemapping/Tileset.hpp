@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -17,6 +18,10 @@
 #include <NasNas/tilemapping/PropertiesContainer.hpp>
 #include <NasNas/tilemapping/Tile.hpp>
 
+namespace pugi {
+    class xml_document;
+}
+
 namespace ns::tm {
 
     class TilesetData : public PropertiesContainer{
@@ -63,9 +68,28 @@ namespace ns::tm {
     public:
         static auto get(const std::string& tsx_file_name) -> const TilesetData&;
 
+        /**
+         * \brief Parses again a TSX file already loaded
+         *
+         * The previous TilesetData is kept alive until the next reload of the file, the TiledMaps using it
+         * stay valid until they are reloaded. With the `hot_reload` AppConfig, the file is parsed on the
+         * default ThreadPool when it changes, and the TilesetData is replaced on the thread updating the App.
+         *
+         * \param tsx_file_name TSX file name, as given to `get`
+         *
+         * \return True if the file was parsed
+         */
+        static auto reload(const std::string& tsx_file_name) -> bool;
+
     private:
         explicit TsxTilesetsManager() = default;
-        std::unordered_map<std::string, TilesetData> m_shared_tilesets;
+        static auto instance() -> TsxTilesetsManager&;
+        static auto parseFile(const std::string& tsx_file_name, pugi::xml_document& xml) -> bool;
+        static auto parse(const std::string& tsx_file_name) -> std::unique_ptr<TilesetData>;
+        static void replace(const std::string& tsx_file_name, const pugi::xml_document& xml);
+
+        std::unordered_map<std::string, std::unique_ptr<TilesetData>> m_shared_tilesets;
+        std::unordered_map<std::string, std::unique_ptr<TilesetData>> m_reloaded_tilesets;    ///< Previous version of each reloaded file
     };
 
 }
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <NasNas/tween/Easing.hpp>
+
+namespace ns {
+
+    /**
+     * \brief Easing function sampled in a lookup table, evaluated by linear interpolation between the samples
+     *
+     * Evaluating a table costs a multiplication and an interpolation, instead of the std::pow, std::sin or
+     * std::exp calls of most easing functions. Tables of the built in easing functions are generated at compile
+     * time, with constexpr versions of the functions computed in double precision. Tables of other functions
+     * (`easing::custom` ones for example) are generated at runtime, or at compile time if the function is constexpr.
+     *
+     * The error of the interpolation decreases with the square of the number of samples, except where the easing
+     * functions are not smooth. Maximum difference with the functions of each family, measured by `getMaxError` on
+     * 2^20 values (see the EasingTable benchmark) :
+     *
+     * | Family                    | 256 samples | 1024 samples |
+     * |---------------------------|-------------|--------------|
+     * | quadratic, cubic          | 2.3e-5      | 1.6e-6       |
+     * | sinusoidal                | 9.5e-6      | 6.6e-7       |
+     * | back                      | 6.9e-5      | 1.9e-5       |
+     * | exponential               | 9.8e-4      | 9.8e-4       |
+     * | elastic                   | 7.5e-3      | 4.9e-3       |
+     * | circular                  | 2.2e-2      | 1.1e-2       |
+     * | bounce                    | 1.7e-2      | 3.3e-2       |
+     *
+     * The last families are dominated by the functions themselves : exponential and elastic ones jump by 2^-10 at
+     * their ends, circular ones have an infinite slope at one end, bounce ones jump by 0.033 between two bounces
+     * and backInOut2 by 1.9e-5 at its middle. Between the samples around these points, the table is a line.
+     *
+     * A table is a callable that can be given to `Tween::with`. The shared tables of `easing_table` live for the
+     * whole program and can be given by reference : `tween.with(std::cref(ns::easing_table<EasingType::BackOut>))`.
+     *
+     * \tparam Samples Number of samples, including both ends
+     */
+    template <std::size_t Samples>
+    class EasingTable {
+        static_assert(Samples >= 2, "An EasingTable needs at least 2 samples");
+    public:
+        /**
+         * \brief Samples a built in easing function, at compile time in constant expressions
+         *
+         * \param type Easing function
+         */
+        constexpr explicit EasingTable(tween::EasingType type);
+
+        /**
+         * \brief Samples an easing function, at compile time if it is constexpr
+         *
+         * \param function Function taking a progress between 0 and 1
+         */
+        template <typename Function, typename = std::enable_if_t<std::is_invocable_r_v<float, Function, float>>>
+        constexpr explicit EasingTable(Function function);
+
+        /**
+         * \brief Evaluates the table, the progress is clamped to [0, 1]
+         *
+         * \param t Progress, between 0 and 1
+         */
+        constexpr auto operator()(float t) const -> float;
+
+        /**
+         * \brief Measures the maximum difference between the table and a function, on evenly spaced progress values
+         *
+         * \param function Function the table was sampled from
+         * \param checks Number of progress values, in [0, 1]
+         */
+        template <typename Function>
+        auto getMaxError(Function function, std::size_t checks=1u << 16) const -> float;
+
+        static constexpr auto getSamplesCount() -> std::size_t;
+
+    private:
+        std::array<float, Samples> m_values = {};
+    };
+
+    /**
+     * \brief Table of a built in easing function, generated at compile time
+     *
+     * \tparam Type Easing function
+     * \tparam Samples Number of samples
+     */
+    template <tween::EasingType Type, std::size_t Samples = 256>
+    inline constexpr EasingTable<Samples> easing_table{Type};
+
+}
+
+#include "NasNas/tween/EasingTable.tpp"
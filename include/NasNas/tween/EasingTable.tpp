@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns {
+
+    namespace detail::table {
+        //// Constexpr math, in double precision //////////////////////////////////
+        namespace constant {
+            constexpr double PI = 3.14159265358979323846;
+            constexpr double LN2 = 0.69314718055994530942;
+
+            constexpr auto sin(double x) -> double {
+                // reduction to [-pi, pi], the Taylor series is below 1e-12 after the x^23 term
+                const auto turns = x / (2 * PI);
+                const auto k = static_cast<long long>(turns < 0 ? turns - 0.5 : turns + 0.5);
+                x -= static_cast<double>(k) * 2 * PI;
+                double term = x, sum = x;
+                for (int n = 1; n < 12; ++n) {
+                    term *= -x * x / ((2*n) * (2*n + 1));
+                    sum += term;
+                }
+                return sum;
+            }
+
+            constexpr auto cos(double x) -> double {
+                return sin(x + PI / 2);
+            }
+
+            constexpr auto exp2(double x) -> double {
+                auto n = static_cast<long long>(x);
+                if (static_cast<double>(n) > x)
+                    n -= 1;
+                // 2^f = e^(f ln2) with f in [0, 1[
+                const auto y = (x - static_cast<double>(n)) * LN2;
+                double term = 1, sum = 1;
+                for (int i = 1; i < 18; ++i) {
+                    term *= y / i;
+                    sum += term;
+                }
+                for (; n > 0; --n)
+                    sum *= 2;
+                for (; n < 0; ++n)
+                    sum /= 2;
+                return sum;
+            }
+
+            constexpr auto sqrt(double x) -> double {
+                if (x <= 0)
+                    return 0;
+                double r = x > 1 ? x : 1;
+                for (int i = 0; i < 64; ++i) {
+                    const auto next = (r + x / r) / 2;
+                    if (next >= r)
+                        break;
+                    r = next;
+                }
+                return r;
+            }
+
+            constexpr auto pow(double x, unsigned n) -> double {
+                double r = 1;
+                for (unsigned i = 0; i < n; ++i)
+                    r *= x;
+                return r;
+            }
+        }
+
+        //// Constexpr built in easing functions, same as Easing.cpp //////////////////////////////////
+        constexpr auto bounceOut(double t) -> double {
+            constexpr double c = 9.5625;
+            if (t < 1 / 2.75)
+                return (c - 2) * t * t;
+            if (t < 2 / 2.75) {
+                t -= 1.5 / 2.75;
+                return (c - 1) * t * t + .75;
+            }
+            if (t < 2.5 / 2.75) {
+                t -= 2.25 / 2.75;
+                return c * t * t + .9375;
+            }
+            t -= 2.625 / 2.75;
+            return c * t * t + .984375;
+        }
+
+        constexpr auto backIn(double t, double pull) -> double {
+            return (pull + 1) * t * t * t - pull * t * t;
+        }
+
+        constexpr auto backIn2(double t, double pull) -> double {
+            return pull * t * t - (pull - 1) * t;
+        }
+
+        constexpr auto exponentialIn(double t) -> double {
+            return t == 0 ? 0 : constant::exp2(10 * t - 10);
+        }
+
+        constexpr auto circularIn(double t) -> double {
+            return 1 - constant::sqrt(1 - t * t);
+        }
+
+        constexpr auto elasticOut(double t) -> double {
+            if (t == 0 || t == 1)
+                return t;
+            return constant::exp2(-10 * t) * constant::sin(2 * constant::PI * (2.5 * t - 1.25)) + 1;
+        }
+
+        constexpr auto evaluateEasing(tween::EasingType type, double t) -> double {
+            using tween::EasingType;
+            using namespace constant;
+            switch (type) {
+                case EasingType::Linear: return t;
+                case EasingType::QuadraticIn: return pow(t, 2);
+                case EasingType::QuadraticOut: return 1 - pow(1 - t, 2);
+                case EasingType::QuadraticInOut: return t < 0.5 ? 2 * pow(t, 2) : 1 - pow(-2 * t + 2, 2) / 2;
+                case EasingType::CubicIn: return pow(t, 3);
+                case EasingType::CubicOut: return 1 - pow(1 - t, 3);
+                case EasingType::CubicInOut: return t < 0.5 ? 4 * pow(t, 3) : 1 - pow(-2 * t + 2, 3) / 2;
+                case EasingType::SinusoidalIn: return 1 - cos(t * PI / 2);
+                case EasingType::SinusoidalOut: return sin(t * PI / 2);
+                case EasingType::SinusoidalInOut: return -cos(PI * t) / 2 + 0.5;
+                case EasingType::ExponentialIn: return exponentialIn(t);
+                case EasingType::ExponentialOut: return 1 - exponentialIn(1 - t);
+                case EasingType::ExponentialInOut:
+                    if (t == 0 || t == 1)
+                        return t;
+                    return t < 0.5 ? exp2(20 * t - 10) / 2 : 1 - exp2(-20 * t + 10) / 2;
+                case EasingType::CircularIn: return circularIn(t);
+                case EasingType::CircularOut: return 1 - circularIn(1 - t);
+                case EasingType::CircularInOut:
+                    return t < 0.5 ? 0.5 - sqrt(1 - pow(2 * t, 2)) / 2 : 0.5 + sqrt(1 - pow(-2 * t + 2, 2)) / 2;
+                case EasingType::BounceIn: return 1 - bounceOut(1 - t);
+                case EasingType::BounceOut: return bounceOut(t);
+                case EasingType::BounceInOut: return t < 0.5 ? 0.5 - bounceOut(1 - 2 * t) / 2 : 0.5 + bounceOut(2 * t - 1) / 2;
+                case EasingType::BackIn: return backIn(t, 2);
+                case EasingType::BackOut: return 1 - backIn(1 - t, 2);
+                case EasingType::BackInOut: {
+                    constexpr double pull = 1.525 * 2;
+                    if (t < 0.5)
+                        return 2 * t * t * (2 * t * (pull + 1) - pull);
+                    return 2 * (t - 1) * (t - 1) * (2 * (pull + 1) * (t - 1) + pull) + 1;
+                }
+                case EasingType::BackIn2: return backIn2(t, 2);
+                case EasingType::BackOut2: return 1 - backIn2(1 - t, 2);
+                case EasingType::BackInOut2: {
+                    constexpr double pull = 2;
+                    if (t < 0.5)
+                        return pull * (1.4142 * t) * (1.4142 * t) - (pull - 1) * t;
+                    t -= 1;
+                    return -pull * (1.4142 * t) * (1.4142 * t) - (pull - 1) * t + 1;
+                }
+                case EasingType::ElasticIn: return 1 - elasticOut(1 - t);
+                case EasingType::ElasticOut: return elasticOut(t);
+                case EasingType::ElasticInOut: {
+                    if (t == 0 || t == 1)
+                        return t;
+                    constexpr double atten = 12. / 25.;
+                    if (t < 0.5)
+                        return -exp2(20 * t - 10) * sin(PI * (20 * t - 11.125) * atten) / 2;
+                    return exp2(-20 * t + 10) * sin(PI * (20 * t - 11.125) * atten) / 2 + 1;
+                }
+                default: return t;
+            }
+        }
+    }
+
+    template <std::size_t Samples>
+    constexpr EasingTable<Samples>::EasingTable(tween::EasingType type) {
+        for (std::size_t i = 0; i < Samples; ++i)
+            m_values[i] = static_cast<float>(detail::table::evaluateEasing(type, static_cast<double>(i) / (Samples - 1)));
+    }
+
+    template <std::size_t Samples>
+    template <typename Function, typename>
+    constexpr EasingTable<Samples>::EasingTable(Function function) {
+        for (std::size_t i = 0; i < Samples; ++i)
+            m_values[i] = static_cast<float>(function(static_cast<float>(i) / static_cast<float>(Samples - 1)));
+    }
+
+    template <std::size_t Samples>
+    constexpr auto EasingTable<Samples>::operator()(float t) const -> float {
+        // written to be false for NaN
+        if (!(t > 0.f))
+            return m_values[0];
+        if (t >= 1.f)
+            return m_values[Samples - 1];
+        const auto x = t * static_cast<float>(Samples - 1);
+        // x can be rounded up to the last sample
+        const auto i = std::min(static_cast<std::size_t>(x), Samples - 2);
+        return m_values[i] + (m_values[i + 1] - m_values[i]) * (x - static_cast<float>(i));
+    }
+
+    template <std::size_t Samples>
+    template <typename Function>
+    auto EasingTable<Samples>::getMaxError(Function function, std::size_t checks) const -> float {
+        float error = 0.f;
+        for (std::size_t i = 0; i < checks; ++i) {
+            const auto t = checks > 1 ? static_cast<float>(i) / static_cast<float>(checks - 1) : 0.f;
+            error = std::max(error, std::abs((*this)(t) - static_cast<float>(function(t))));
+        }
+        return error;
+    }
+
+    template <std::size_t Samples>
+    constexpr auto EasingTable<Samples>::getSamplesCount() -> std::size_t {
+        return Samples;
+    }
+
+}
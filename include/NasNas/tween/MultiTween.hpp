@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <vector>
 
+#include <NasNas/core/data/TimeSource.hpp>
 #include <NasNas/tween/Easing.hpp>
 
 namespace ns {
@@ -32,6 +33,20 @@ namespace ns {
         auto with(const tween::EasingFunction& fn) -> MultiTween<N>&;
         auto with(std::array<tween::EasingFunction, N> fn) -> MultiTween<N>&;
 
+        /**
+         * \brief Set a built in easing function for all the values, evaluated once per step instead of once per value
+         *
+         * \param type Easing function
+         */
+        auto with(tween::EasingType type) -> MultiTween<N>&;
+
+        /**
+         * \brief Set a built in easing function per value
+         *
+         * \param types Easing functions, EasingType::Count keeps the easing function of the value
+         */
+        auto with(const std::array<tween::EasingType, N>& types) -> MultiTween<N>&;
+
         auto delay(float delay) -> MultiTween<N>&;
 
         void onEnd(std::function<void()> fn);
@@ -42,13 +57,21 @@ namespace ns {
 
         auto step() -> float;
 
+        /**
+         * \brief Set the group of the TimeSource the MultiTween follows, the default group by default
+         *
+         * \param group Group of the default TimeSource, to pause or dilate it with other animations
+         */
+        void setTimeGroup(TimeSource::Group group);
+
     private:
-        sf::Clock m_clock;
+        GameClock m_clock;
         std::vector<std::array<float, N>> m_starts;
         std::vector<std::array<float, N>> m_ends;
         std::vector<float> m_durations;
         std::vector<float> m_delays;
         std::vector<std::array<tween::EasingFunction, N>> m_easing_fns;
+        std::vector<std::array<tween::EasingType, N>> m_easing_types;     ///< EasingType::Count to use the easing functions
         std::vector<tween::MultiCallbackFunction<N>> m_on_step_cbs;
         std::function<void()> m_on_end_cb = []{};
         unsigned m_index = 0;
@@ -17,6 +17,8 @@ namespace ns {
         m_easing_fns.clear();
         m_easing_fns.emplace_back();
         m_easing_fns.back().fill(easing::linear);
+        m_easing_types.clear();
+        m_easing_types.emplace_back().fill(tween::EasingType::Count);
         m_on_step_cbs = {[](std::array<float, N>){}};
         m_index = 0;
         m_initial_delay = 0.f;
@@ -78,12 +80,26 @@ namespace ns {
         for (auto& easing : m_easing_fns[m_index]) {
             easing = fn;
         }
+        m_easing_types[m_index].fill(tween::EasingType::Count);
         return *this;
     }
 
     template <unsigned int N, typename E>
     auto MultiTween<N, E>::with(std::array<tween::EasingFunction, N> fn) -> MultiTween<N>& {
         m_easing_fns[m_index] = std::move(fn);
+        m_easing_types[m_index].fill(tween::EasingType::Count);
+        return *this;
+    }
+
+    template <unsigned int N, typename E>
+    auto MultiTween<N, E>::with(tween::EasingType type) -> MultiTween<N>& {
+        m_easing_types[m_index].fill(type);
+        return *this;
+    }
+
+    template <unsigned int N, typename E>
+    auto MultiTween<N, E>::with(const std::array<tween::EasingType, N>& types) -> MultiTween<N>& {
+        m_easing_types[m_index] = types;
         return *this;
     }
 
@@ -108,6 +124,11 @@ namespace ns {
             m_on_step_cbs[0](m_starts[0]);
     }
 
+    template <unsigned int N, typename E>
+    void MultiTween<N, E>::setTimeGroup(TimeSource::Group group) {
+        m_clock.setGroup(group);
+    }
+
     template <unsigned int N, typename E>
     auto MultiTween<N, E>::ended() const -> bool {
         return m_index >= m_starts.size();
@@ -121,7 +142,7 @@ namespace ns {
         }
 
         if (m_current_delay > 0.f) {
-            if (m_clock.getElapsedTime().asSeconds() < m_current_delay)
+            if (m_clock.getElapsedTime() < m_current_delay)
                 return 0.f;
             else {
                 m_current_delay = 0.f;
@@ -139,15 +160,23 @@ namespace ns {
                 return 1.f;
         }
 
-        auto pt = m_clock.getElapsedTime().asSeconds() / m_durations[m_index];
+        auto pt = m_clock.getElapsedTime() / m_durations[m_index];
 
         auto& easing_fns = m_easing_fns[m_index];
+        auto& easing_types = m_easing_types[m_index];
         auto& callback = m_on_step_cbs[m_index];
 
         if (pt < 1.f) {
             std::array<float, N> values;
+            // all the values share the progress, consecutive values with the same easing type share the result.
+            // values without easing type (EasingType::Count) use their easing function
             for (unsigned i = 0; i < N; ++i) {
-                values[i] = easing_fns[i](pt);
+                if (easing_types[i] == tween::EasingType::Count)
+                    values[i] = easing_fns[i](pt);
+                else if (i > 0 && easing_types[i] == easing_types[i-1])
+                    values[i] = values[i-1];
+                else
+                    values[i] = easing::evaluate(easing_types[i], pt);
             }
             interpolate(m_index, values);
             callback(values);
@@ -166,6 +195,7 @@ namespace ns {
         m_durations.emplace_back(1.f);
         m_delays.emplace_back(0.f);
         m_easing_fns.emplace_back(m_easing_fns.back());
+        m_easing_types.emplace_back(m_easing_types.back());
         m_on_step_cbs.emplace_back(m_on_step_cbs.back());
     }
 
@@ -5,8 +5,7 @@
 #include <functional>
 #include <vector>
 
-#include <SFML/System/Clock.hpp>
-
+#include <NasNas/core/data/TimeSource.hpp>
 #include <NasNas/tween/Easing.hpp>
 
 namespace ns {
@@ -41,8 +40,26 @@ namespace ns {
 
         auto step() -> float;
 
+        /**
+         * \brief Set the group of the TimeSource the Tween follows, the default group by default
+         *
+         * \param group Group of the default TimeSource, to pause or dilate it with other animations
+         */
+        void setTimeGroup(TimeSource::Group group);
+
+        /**
+         * \brief Get the value given to the callback by the last `step`, blended with the value of the step before
+         *
+         * Tweens stepped in `update` can be displayed smoothly with App::getInterpolation.
+         *
+         * \param alpha Interpolation factor, 0 for the value of the previous step, 1 for the last value
+         *
+         * \return Tweened value
+         */
+        auto getValue(float alpha=1.f) const -> float;
+
     private:
-        sf::Clock m_clock;
+        GameClock m_clock;
         std::vector<float> m_starts;
         std::vector<float> m_ends;
         std::vector<float> m_durations = {1.f};
@@ -53,6 +70,8 @@ namespace ns {
         unsigned m_index = 0;
         float m_initial_delay = 0.f;
         float m_current_delay = 0.f;
+        float m_value = 0.f;            ///< Value of the last step
+        float m_previous_value = 0.f;   ///< Value of the step before the last one
         bool m_first_run = true;
         bool m_on_end_called = false;
         bool m_loop = false;
@@ -62,6 +81,8 @@ namespace ns {
         };
 
         void emplaceAnimation();
+
+        void setValue(unsigned i, float value);
     };
 
 }
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <NasNas/tween/Easing.hpp>
+
+namespace ns {
+    class TweenManager;
+
+    /**
+     * \brief Identifies a tween of a TweenManager, it stays valid until the tween ends or is removed
+     */
+    class TweenId {
+    public:
+        TweenId() = default;
+
+        auto isValid() const -> bool;
+
+        auto operator==(const TweenId& other) const -> bool;
+        auto operator!=(const TweenId& other) const -> bool;
+
+    private:
+        friend TweenManager;
+        static constexpr std::uint32_t Invalid = std::numeric_limits<std::uint32_t>::max();
+
+        TweenId(std::uint32_t index, std::uint32_t generation);
+
+        std::uint32_t m_index = Invalid;
+        std::uint32_t m_generation = 0;
+    };
+
+    /**
+     * \brief Advances many tweens at once from the time elapsed since the previous update
+     *
+     * Each tween goes from a start value to an end value with a built in easing function. The tweens are
+     * stored in structure of arrays and advanced in a single loop, then the tweens sharing an easing function
+     * are evaluated together with `easing::evaluate` in batches. The values can be written directly to a target float, or given to step callbacks; the callbacks
+     * are called in a batch after all the tweens are advanced, in the order they were set, then the end
+     * callbacks are called and the ended tweens are removed.
+     *
+     * Use ns::Tween for custom easing functions and sequences of animations.
+     */
+    class TweenManager {
+    public:
+        /**
+         * \brief Adds a tween, it starts on the next update
+         *
+         * \param start Start value
+         * \param end End value
+         * \param duration Duration, in seconds
+         * \param easing Easing function
+         *
+         * \return Id of the tween
+         */
+        auto add(float start, float end, float duration, tween::EasingType easing=tween::EasingType::Linear) -> TweenId;
+
+        /**
+         * \brief Adds a tween writing its value to a target
+         *
+         * \param target Float written on each update, it must outlive the tween
+         * \param start Start value
+         * \param end End value
+         * \param duration Duration, in seconds
+         * \param easing Easing function
+         *
+         * \return Id of the tween
+         */
+        auto add(float* target, float start, float end, float duration, tween::EasingType easing=tween::EasingType::Linear) -> TweenId;
+
+        /**
+         * \brief Set the time waited before the tween starts, its value is not updated meanwhile
+         *
+         * \param id Tween id
+         * \param delay Delay, in seconds
+         */
+        void setDelay(TweenId id, float delay);
+
+        /**
+         * \brief Set if the tween restarts when it ends, a looping tween never ends
+         *
+         * \param id Tween id
+         * \param loop True to loop
+         */
+        void setLoop(TweenId id, bool loop);
+
+        /**
+         * \brief Set the float written on each update, nullptr to write nothing
+         *
+         * \param id Tween id
+         * \param target Target, it must outlive the tween
+         */
+        void setTarget(TweenId id, float* target);
+
+        /**
+         * \brief Set the function called with the value of the tween after each update
+         *
+         * \param id Tween id
+         * \param callback Step callback
+         */
+        void onStep(TweenId id, tween::CallbackFunction callback);
+
+        /**
+         * \brief Set the function called once the tween ended, before it is removed
+         *
+         * \param id Tween id
+         * \param callback End callback
+         */
+        void onEnd(TweenId id, std::function<void()> callback);
+
+        /**
+         * \brief Removes a tween, its end callback is not called
+         *
+         * \param id Tween id
+         */
+        void remove(TweenId id);
+
+        auto isRunning(TweenId id) const -> bool;
+
+        /**
+         * \brief Get the value computed by the last update, or the start value before the first one
+         *
+         * \param id Tween id
+         */
+        auto getValue(TweenId id) const -> float;
+
+        /**
+         * \brief Advances all the tweens, then calls the step and end callbacks
+         *
+         * Callbacks can add and remove tweens, added tweens start on the next update.
+         *
+         * \param dt Time elapsed since the previous update, in seconds
+         */
+        void update(float dt);
+
+        /**
+         * \brief Removes all the tweens, must not be called from a callback
+         */
+        void clear();
+
+        auto getCount() const -> std::size_t;
+
+    private:
+        enum Flags : std::uint8_t {
+            Loop = 1u << 0,
+            Stepped = 1u << 1,      ///< Was advanced by the last update, not waiting for its delay
+            Ended = 1u << 2
+        };
+
+        struct StepCallback {
+            TweenId id;
+            tween::CallbackFunction callback;
+        };
+
+        auto getDenseIndex(TweenId id) const -> std::uint32_t;
+        void erase(TweenId id);
+        void evaluateEasings();
+        void setStepCallback(StepCallback step_callback);
+        void removeStepCallbacks();
+
+        // tweens data, packed
+        std::vector<float> m_starts;
+        std::vector<float> m_deltas;                    ///< End value minus start value
+        std::vector<float> m_inverse_durations;
+        std::vector<float> m_elapsed;                   ///< Time since the tween was added, delay included
+        std::vector<float> m_delays;
+        std::vector<float> m_values;
+        std::vector<tween::EasingType> m_easings;
+        std::vector<std::uint8_t> m_flags;
+        std::vector<float*> m_targets;
+        std::vector<std::uint32_t> m_slots;             ///< Slot of each tween
+
+        // update buffers, kept to not allocate each update
+        std::vector<float> m_progress;                  ///< Progress of each tween, then its eased value
+        std::vector<float> m_batch;                     ///< Progress values grouped by easing function
+        std::vector<std::uint32_t> m_order;             ///< Tween of each grouped value
+
+        // slots, indexed by TweenId
+        std::vector<std::uint32_t> m_dense_indices;
+        std::vector<std::uint32_t> m_generations;
+        std::vector<std::function<void()>> m_end_callbacks;
+        std::vector<std::uint32_t> m_step_callbacks_indices;
+        std::vector<std::uint32_t> m_free_slots;
+
+        std::vector<StepCallback> m_step_callbacks;
+        std::vector<StepCallback> m_added_step_callbacks;   ///< Set by callbacks during the update
+        std::vector<TweenId> m_ended;
+        std::vector<TweenId> m_removed;                 ///< Tweens removed by callbacks during the update
+        bool m_updating = false;
+    };
+
+}
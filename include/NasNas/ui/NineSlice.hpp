@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Transformable.hpp>
@@ -23,6 +25,7 @@ namespace ns::ui {
         void setMode(Mode mode);
 
         void setTexture(const sf::Texture& texture, bool reset_rect = false);
+        auto getTexture() const -> const sf::Texture*;
         void setTextureRect(const sf::IntRect& rect);
         void setSlices(int left, int right, int top, int bottom);
 
@@ -32,6 +35,18 @@ namespace ns::ui {
 
         auto getGlobalBounds() const -> sf::FloatRect;
 
+        /**
+         * \brief Appends the transformed triangles of the NineSlice to a vertices array
+         *
+         * Used by the RenderQueue to merge the draw calls of drawables sharing a texture.
+         *
+         * \param vertices Array to append the triangles to
+         */
+        void batchTriangles(std::vector<sf::Vertex>& vertices) const;
+
+        /// Opts in to batching, subclasses are drawn with their own `draw` unless they declare it again
+        using Batchable = NineSlice;
+
     private:
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
         void updateVertices();
@@ -4,10 +4,15 @@
 
 #include <NasNas/core/App.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
 
+#include <SFML/System/Sleep.hpp>
 #include <SFML/Window/Touch.hpp>
 
+#include <NasNas/core/data/FileWatcher.hpp>
+#include <NasNas/core/data/TimeSource.hpp>
 #include <NasNas/core/graphics/Renderable.hpp>
 #include <NasNas/core/Inputs.hpp>
 #include <NasNas/core/Transition.hpp>
@@ -27,7 +32,8 @@ App::App(std::string title, sf::Vector2u resolution, float scale, int fps, int u
         m_title(std::move(title)),
         m_fullscreen(false),
         m_ups(ups),
-        m_fps(fps)
+        m_fps(fps),
+        m_scheduler(ups)
 {
     detail::AppComponent::app = this;
 
@@ -45,12 +51,15 @@ App::App(std::string title, sf::Vector2u resolution, float scale, int fps, int u
     Settings::user_config.view_size = view_size;
     Settings::user_config.view_ratio = view_ratio;
 
-    m_window.create(Settings::user_config.video_mode, m_title, Settings::user_config.window_style);
+    // headless apps have no window, and never create an OpenGL context
+    if (!Settings::user_config.headless) {
+        m_window.create(Settings::user_config.video_mode, m_title, Settings::user_config.window_style);
 
-    if (fps > 0)
-        m_window.setFramerateLimit(fps);
+        if (fps > 0)
+            m_window.setFramerateLimit(fps);
 
-    m_renderer.create((unsigned int)m_window.getAppView().getSize().x, (unsigned int)m_window.getAppView().getSize().y);
+        m_renderer.create((unsigned int)m_window.getAppView().getSize().x, (unsigned int)m_window.getAppView().getSize().y);
+    }
     m_debug_bounds.reserve(100*4);
 
     m_dt = 0.0;
@@ -153,6 +162,16 @@ auto App::createCamera(const std::string& cam_name, int order, const ns::FloatRe
     return createCamera(cam_name, order, {{0, 0}, sf::Vector2i(Settings::user_config.view_size)}, viewport);
 }
 
+void App::quit() {
+    m_quit = true;
+    if (m_window.isOpen())
+        m_window.close();
+}
+
+auto App::isHeadless() const -> bool {
+    return Settings::getConfig().headless;
+}
+
 void App::sleep() {
     m_sleeping = true;
 }
@@ -165,7 +184,20 @@ auto App::getDt() const -> float {
     return m_dt;
 }
 
+auto App::getUpdateScheduler() -> UpdateScheduler& {
+    return m_scheduler;
+}
+
+auto App::getInterpolation() const -> float {
+    return m_alpha;
+}
+
 void App::toggleFullscreen() {
+    if (m_render_thread.joinable()) {
+        // the window can not be recreated while the render thread draws on it
+        m_fullscreen_requested = true;
+        return;
+    }
     auto clear_color = m_window.getClearColor();
     if(!m_fullscreen) {
         m_window.create(sf::VideoMode::getFullscreenModes()[0], m_title, sf::Style::None);
@@ -181,6 +213,7 @@ void App::toggleFullscreen() {
 
 void App::addDebugText(const std::string& label, const sf::Vector2f& position, const sf::Color& color) {
     auto* dbg_txt = new DebugText<char>(label, position);
+    Allocations::record(1, 1, sizeof(DebugText<char>));
     dbg_txt->setFillColor(color);
     m_debug_texts.emplace_back(dbg_txt);
 }
@@ -220,11 +253,28 @@ void App::onEvent(const sf::Event& event) {
 
 void App::update() {}
 
+void App::savePreviousState() {
+    for (auto& cam : m_cameras)
+        if (cam.hasInterpolation())
+            cam.savePreviousState();
+    for (auto& scene : m_scenes) {
+        if (scene.m_default_layer.hasInterpolation())
+            scene.m_default_layer.savePreviousState();
+        for (auto& layer : scene.m_layers)
+            if (layer.hasInterpolation())
+                layer.savePreviousState();
+    }
+}
+
 void App::render() {
     // draw Cameras content on AppView
     m_window.setView(m_window.getAppView());
 
-    m_renderer.clear(sf::Color::Transparent);
+    // without shader nor fractional scale, the intermediate texture is not needed
+    const bool direct = canRenderDirectly();
+    sf::RenderTarget& target = direct ? static_cast<sf::RenderTarget&>(m_window) : m_renderer;
+    if (!direct)
+        m_renderer.clear(sf::Color::Transparent);
 
     // render renderables
     for (auto* renderable : Renderable::list) {
@@ -234,21 +284,30 @@ void App::render() {
     // for each camera, if it has a scene and is visible, render the content
     for (auto& cam : m_cameras) {
         if (cam.hasScene() && cam.isVisible()) {
-            cam.render(m_renderer);
+            cam.render(target, m_alpha);
         }
     }
-    // render transitions
+    renderTransitions(target);
+
+    if (!direct) {
+        m_renderer.display();
+        m_window.draw(sf::Sprite(m_renderer.getTexture()), getShader());
+    }
+
+    // draw debug things on ScreenView
+    m_window.setView(m_window.getScreenView());
+    renderDebug();
+}
+
+void App::renderTransitions(sf::RenderTarget& target) {
     for (auto& transition : m_transitions) {
         if (transition->hasStarted()) {
-            m_renderer.draw(*transition);
+            target.draw(*transition);
         }
     }
+}
 
-    m_renderer.display();
-    m_window.draw(sf::Sprite(m_renderer.getTexture()), getShader());
-
-    // draw debug things on ScreenView
-    m_window.setView(m_window.getScreenView());
+void App::renderDebug() {
     // draw debug bounds
     if (Settings::debug_mode && Settings::debug_mode.show_bounds) {
        renderDebugBounds();
@@ -262,6 +321,128 @@ void App::render() {
     }
 }
 
+void App::startRenderThread() {
+    m_frames = std::make_unique<FrameBuffers<Frame>>(Settings::getConfig().render_buffers);
+    m_window.m_defer_close = true;
+    // the OpenGL context of the window can only be active on one thread at a time
+    m_window.setActive(false);
+    m_render_thread = std::thread([this] {
+        m_window.setActive(true);
+        while (auto* frame = m_frames->beginRead()) {
+            renderFrame(*frame);
+            m_frames->endRead();
+        }
+        m_window.setActive(false);
+    });
+}
+
+void App::stopRenderThread() {
+    if (!m_render_thread.joinable())
+        return;
+    m_frames->stop();
+    m_render_thread.join();
+    m_frames.reset();
+    m_window.m_defer_close = false;
+    m_window.setActive(true);
+}
+
+void App::captureFrame() {
+    auto& frame = m_frames->beginWrite();
+    // cameras refreshed by a frame that was never drawn have to be refreshed again
+    if (!frame.consumed) {
+        for (std::size_t i = 0; i < frame.cameras_count; ++i)
+            if (frame.cameras[i].refresh)
+                frame.cameras[i].camera->m_dirty = true;
+    }
+
+    frame.app_view = m_window.getAppView();
+    frame.screen_view = m_window.getScreenView();
+    frame.clear_color = m_window.getClearColor();
+    frame.direct = canRenderDirectly();
+    // shaders are not copied, their uniforms are set by preRender on the update thread
+    frame.live = !Renderable::list.empty() || !m_transitions.empty() || getShader() != nullptr
+                 || (Settings::debug_mode && (Settings::debug_mode.show_bounds || Settings::debug_mode.show_text));
+    frame.consumed = false;
+
+    const auto target_size = frame.direct ? m_window.getSize() : m_renderer.getSize();
+    const auto target_vport = frame.direct ? frame.app_view.getViewport() : sf::FloatRect(0, 0, 1, 1);
+    frame.cameras_count = 0;
+    for (auto& cam : m_cameras) {
+        if (!cam.hasScene() || !cam.isVisible())
+            continue;
+        if (frame.cameras_count == frame.cameras.size())
+            frame.cameras.emplace_back();
+        auto& cam_frame = frame.cameras[frame.cameras_count++];
+        cam_frame.camera = &cam;
+        cam_frame.view = cam.getInterpolatedView(m_alpha);
+        cam_frame.direct = cam.m_refresh_policy == Camera::RefreshPolicy::EveryFrame
+                           && cam.canRenderDirectly(target_size, target_vport);
+        cam_frame.refresh = cam_frame.direct || cam.beginRefresh(cam_frame.view);
+        cam.m_sprite.setTexture(cam.m_render_texture->getTexture());
+        cam_frame.sprite = cam.m_sprite;
+        frame.live = frame.live || (!cam_frame.direct && cam.getShader() != nullptr);
+        cam_frame.queue.clear();
+        if (cam_frame.refresh) {
+            cam.m_scene->temporaryLinkCamera(cam_frame.view, m_alpha);
+            cam_frame.queue.setCapturing(true);
+            cam.m_scene->queueLayers(cam_frame.queue);
+            frame.live = frame.live || cam_frame.queue.getLiveCommandsCount() > 0;
+        }
+    }
+    m_frames->endWrite();
+}
+
+void App::renderFrame(Frame& frame) {
+    // captured content can be drawn while the next frame is updated, live content can not
+    std::unique_lock<std::mutex> lock(m_state_mutex, std::defer_lock);
+    if (frame.live)
+        lock.lock();
+
+    m_window.clear(frame.clear_color);
+    m_window.setView(frame.app_view);
+    sf::RenderTarget& target = frame.direct ? static_cast<sf::RenderTarget&>(m_window) : m_renderer;
+    if (!frame.direct)
+        m_renderer.clear(sf::Color::Transparent);
+
+    if (frame.live) {
+        for (auto* renderable : Renderable::list) {
+            renderable->render();
+        }
+    }
+    for (std::size_t i = 0; i < frame.cameras_count; ++i) {
+        auto& cam_frame = frame.cameras[i];
+        cam_frame.camera->render(target, cam_frame.view, cam_frame.direct, cam_frame.refresh, cam_frame.sprite,
+            [&cam_frame](sf::RenderTarget& t) { cam_frame.queue.flush(t, sf::RenderStates::Default); }
+        );
+    }
+    if (frame.live)
+        renderTransitions(target);
+
+    if (!frame.direct) {
+        m_renderer.display();
+        m_window.draw(sf::Sprite(m_renderer.getTexture()), getShader());
+    }
+
+    m_window.setView(frame.screen_view);
+    if (frame.live)
+        renderDebug();
+    if (lock.owns_lock())
+        lock.unlock();
+
+    frame.consumed = true;
+    m_window.display();
+}
+
+auto App::canRenderDirectly() const -> bool {
+    if (!Settings::getConfig().direct_rendering || getShader() != nullptr)
+        return false;
+    const auto& vport = m_window.getAppView().getViewport();
+    auto scale_x = static_cast<float>(m_window.getSize().x)*vport.width / static_cast<float>(m_renderer.getSize().x);
+    auto scale_y = static_cast<float>(m_window.getSize().y)*vport.height / static_cast<float>(m_renderer.getSize().y);
+    auto is_integer = [](float value) { return value >= 1.f && std::abs(value - std::round(value)) < 1e-3f; };
+    return is_integer(scale_x) && is_integer(scale_y);
+}
+
 void App::renderDebugBounds() {
     // draw app view bounds
     sf::Vector2f s{m_window.getAppView().getViewport().width*m_window.getSize().x,
@@ -323,30 +504,113 @@ void App::storeDrawableDebugRects(const ns::FloatRect& drawable_bounds, Camera&
     }
 }
 
+void App::step() {
+    m_dt = m_scheduler.getSliceTime();
+    // the animations follow the updates : fixed time step, stopped while sleeping
+    TimeSource::getDefault().advance(m_dt);
+    savePreviousState();
+    update();
+    m_cb_update();
+    for (auto& cam : m_cameras)
+        cam.update();
+
+    // remove transitions that already ended
+    m_transitions.remove_if([](auto& transition) { return transition->hasEnded(); });
+
+    for (auto& transition : m_transitions)
+        transition->update();
+
+    Inputs::get().m_keys_pressed.clear();
+    Inputs::get().m_keys_released.clear();
+}
+
+void App::renderVertices() {
+    for (auto& cam : m_cameras) {
+        if (cam.hasScene() && cam.isVisible()) {
+            auto& queue = cam.m_scene->m_render_queue;
+            cam.m_scene->temporaryLinkCamera(cam.getInterpolatedView(m_alpha), m_alpha);
+            queue.clear();
+            queue.setCapturing(true);
+            cam.m_scene->queueLayers(queue);
+        }
+    }
+}
+
+void App::runHeadless() {
+    const bool realtime = Settings::getConfig().headless_realtime;
+    const bool vertex_pass = Settings::getConfig().headless_vertex_pass;
+    m_fps_clock.restart();
+    while (!m_quit) {
+        // without real time pacing, each frame runs exactly one update
+        m_dt = realtime ? m_fps_clock.restart().asSeconds() : m_scheduler.getSliceTime();
+        m_scheduler.beginFrame(m_dt);
+        Allocations::newFrame();
+        FileWatcher::getDefault().update();
+
+        bool updated = false;
+        while (m_scheduler.step()) {
+            if (!m_sleeping) {
+                step();
+                updated = true;
+            }
+        }
+        m_alpha = m_scheduler.getAlpha();
+
+        if (!m_sleeping && updated) {
+            preRender();
+            m_cb_prerender();
+            if (vertex_pass)
+                renderVertices();
+        }
+        if (realtime && !updated)
+            sf::sleep(sf::seconds(m_scheduler.getTimeToNextUpdate()));
+    }
+}
+
 void App::run() {
     // initialize Inputs manager
     Inputs::init();
     // sort cameras by render order
     m_cameras.sort([](Camera& lhs, Camera& rhs) { return lhs.getRenderOrder() < rhs.getRenderOrder(); });
 
-    float slice_time = 1.f / static_cast<float>(m_ups);
-    float current_slice = slice_time;
+    m_quit = false;
+    if (Settings::getConfig().headless) {
+        runHeadless();
+        return;
+    }
+
+    const bool threaded = Settings::getConfig().render_thread;
+    if (threaded)
+        startRenderThread();
+
     sf::Clock timer;
-    sf::Clock update_clock;
     std::array<float, 30> dt_buffer{};
     size_t dt_i = 0;
-    while (m_window.isOpen()) {
+    while (m_window.isOpen() && !m_window.m_close_requested) {
         m_dt = m_fps_clock.restart().asSeconds();
-        current_slice += m_dt;
+        m_scheduler.beginFrame(m_dt);
+        Allocations::newFrame();
 
         if (Settings::debug_mode && Settings::debug_mode.show_fps && timer.getElapsedTime().asMilliseconds()>200) {
             auto dt_average = std::accumulate(dt_buffer.begin(), dt_buffer.end(), 0.f) / dt_buffer.size();;
-            m_window.setTitle(m_title+ " | FPS :" + std::to_string(static_cast<int>(1 / dt_average)) + " (" + std::to_string((1/m_dt)) + ")");
+            const auto& stats = m_scheduler.getStats();
+            m_window.setTitle(m_title+ " | FPS :" + std::to_string(static_cast<int>(1 / dt_average)) + " (" + std::to_string((1/m_dt)) + ")"
+                              + " | UPS :" + std::to_string(stats.updates) + " (late " + std::to_string(stats.late)
+                              + ", skipped " + std::to_string(stats.skipped) + ")"
+                              + " | Allocs :" + std::to_string(Allocations::getFrameStats().allocations));
             timer.restart();
         }
         dt_buffer[dt_i++] = m_dt;
         dt_i %= dt_buffer.size();
 
+        // the render thread can only read the App state while it is not updated
+        std::unique_lock<std::mutex> lock(m_state_mutex, std::defer_lock);
+        if (threaded)
+            lock.lock();
+
+        // reloaded resources are replaced in place, they can be drawn by the render thread
+        FileWatcher::getDefault().update();
+
         // get and store inputs
         sf::Event event{};
         while (m_window.pollEvent(event)) {
@@ -355,35 +619,48 @@ void App::run() {
             m_cb_onevent(event);
         }
         // update the app
-        update_clock.restart();
-        while (current_slice >= slice_time) {
-            current_slice -= slice_time;
-            if (update_clock.getElapsedTime().asSeconds() > slice_time)
-                break;
+        bool updated = false;
+        while (m_scheduler.step()) {
             if (!m_sleeping) {
-                m_dt = slice_time;
-                update();
-                m_cb_update();
-                for (auto& cam : m_cameras)
-                    cam.update();
-
-                // remove transitions that already ended
-                m_transitions.remove_if([](auto& transition) { return transition->hasEnded(); });
-
-                for (auto& transition : m_transitions)
-                    transition->update();
-
-                Inputs::get().m_keys_pressed.clear();
-                Inputs::get().m_keys_released.clear();
+                step();
+                updated = true;
             }
         }
+        // time elapsed since the last update, rendered states are blended with the previous ones.
+        // captured frames are taken right after an update, they show the current state
+        m_alpha = threaded ? 1.f : m_scheduler.getAlpha();
+
         // render drawables and display window
-        if (!m_sleeping) {
+        if (!m_sleeping && !threaded) {
             m_window.clear(m_window.getClearColor());
             preRender();
             m_cb_prerender();
             render();
             m_window.display();
         }
+        else if (!m_sleeping && updated) {
+            preRender();
+            m_cb_prerender();
+            captureFrame();
+        }
+
+        if (threaded) {
+            lock.unlock();
+            if (m_fullscreen_requested) {
+                m_fullscreen_requested = false;
+                stopRenderThread();
+                toggleFullscreen();
+                startRenderThread();
+            }
+            // the render thread is limited by the framerate, wait for the next update instead of spinning
+            if (!updated)
+                sf::sleep(sf::seconds(m_scheduler.getTimeToNextUpdate()));
+        }
+    }
+
+    stopRenderThread();
+    if (m_window.m_close_requested) {
+        m_window.m_close_requested = false;
+        m_window.close();
     }
 }
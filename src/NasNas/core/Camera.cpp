@@ -4,6 +4,7 @@
 
 #include <NasNas/core/Camera.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 #include <SFML/Graphics/RenderTarget.hpp>
@@ -37,18 +38,23 @@ void Camera::reset(const ns::IntRect& rectangle) {
     sf::ContextSettings settings;
     settings.antialiasingLevel = ns::Settings::getConfig().antialiasing_level;
     m_base_view = rectangle;
-    m_render_texture->create(static_cast<unsigned>(rectangle.width), static_cast<unsigned>(rectangle.height), settings);
+    if (!ns::Settings::getConfig().headless)
+        m_render_texture->create(static_cast<unsigned>(rectangle.width), static_cast<unsigned>(rectangle.height), settings);
     sf::View::reset(sf::FloatRect(rectangle));
+    m_previous_center = getCenter();
+    m_dirty = true;
+    updateSprite();
 }
 
 void Camera::resetViewport(float x, float y, float w, float h) {
-    m_base_viewport = {x, y, w, h};
+    resetViewport(sf::FloatRect(x, y, w, h));
 }
 void Camera::resetViewport(const sf::Vector2f& position, const sf::Vector2f& size) {
-    m_base_viewport = {position, size};
+    resetViewport(sf::FloatRect(position, size));
 }
 void Camera::resetViewport(const sf::FloatRect& rect) {
     m_base_viewport = rect;
+    updateSprite();
 }
 
 auto Camera::getViewport() const -> const ns::FloatRect& {
@@ -61,6 +67,7 @@ auto Camera::isVisible() const -> bool { return m_visible; }
 
 void Camera::lookAt(Scene& target_scene) {
     m_scene = &target_scene;
+    m_dirty = true;
 }
 
 void Camera::follow(sf::Transformable& transformable) {
@@ -149,21 +156,129 @@ void Camera::update() {
     }
 }
 
-void Camera::render(sf::RenderTarget& target) {
-    m_render_texture->setView(*this);
-    m_render_texture->clear(sf::Color::Transparent);
+void Camera::setRefreshPolicy(RefreshPolicy policy, unsigned int frames) {
+    m_refresh_policy = policy;
+    m_refresh_frames = std::max(1u, frames);
+    m_dirty = true;
+}
+
+auto Camera::getRefreshPolicy() const -> RefreshPolicy {
+    return m_refresh_policy;
+}
+
+void Camera::markDirty() {
+    m_dirty = true;
+}
+
+void Camera::setInterpolation(bool value) {
+    m_interpolation = value;
+    m_previous_center = getCenter();
+}
 
-    m_scene->temporaryLinkCamera(this);
-    m_render_texture->draw(*m_scene);
+auto Camera::hasInterpolation() const -> bool {
+    return m_interpolation;
+}
+
+auto Camera::getInterpolatedView(float alpha) const -> sf::View {
+    sf::View view = *this;
+    if (m_interpolation)
+        view.setCenter(m_previous_center + (getCenter() - m_previous_center)*alpha);
+    return view;
+}
 
-    m_render_texture->display();
+void Camera::savePreviousState() {
+    m_previous_center = getCenter();
+}
+
+void Camera::render(sf::RenderTarget& target, float alpha) {
+    const auto view = getInterpolatedView(alpha);
+    m_scene->temporaryLinkCamera(view, alpha);
+    // cached content can only be kept in the render texture
+    const bool direct = m_refresh_policy == RefreshPolicy::EveryFrame
+                        && canRenderDirectly(target.getSize(), target.getView().getViewport());
+    const bool refresh = direct || beginRefresh(view);
     m_sprite.setTexture(m_render_texture->getTexture());
+    render(target, view, direct, refresh, m_sprite, [this](sf::RenderTarget& t) { t.draw(*m_scene); });
+}
+
+void Camera::render(sf::RenderTarget& target, const sf::View& view, bool direct, bool refresh, const sf::Sprite& sprite,
+                    const std::function<void(sf::RenderTarget&)>& draw_scene) {
+    if (direct) {
+        // the camera viewport is relative to the viewport of the target view
+        auto target_view = target.getView();
+        const auto& target_vport = target_view.getViewport();
+        sf::View camera_view = view;
+        camera_view.setViewport({
+            target_vport.left + m_base_viewport.left*target_vport.width,
+            target_vport.top + m_base_viewport.top*target_vport.height,
+            m_base_viewport.width*target_vport.width,
+            m_base_viewport.height*target_vport.height
+        });
+        target.setView(camera_view);
+        draw_scene(target);
+        target.setView(target_view);
+        return;
+    }
+
+    if (refresh) {
+        m_render_texture->setView(view);
+        m_render_texture->clear(sf::Color::Transparent);
+        draw_scene(*m_render_texture);
+        m_render_texture->display();
+    }
+
+    target.draw(sprite, getShader());
+}
+
+auto Camera::beginRefresh(const sf::View& view) -> bool {
+    const bool refresh = m_refresh_policy == RefreshPolicy::EveryFrame || needsRefresh(view);
+    if (refresh) {
+        m_dirty = false;
+        m_frames_since_refresh = 0;
+        m_rendered_scene = m_scene;
+        m_rendered_version = m_scene->getVersion();
+        m_rendered_center = view.getCenter();
+        m_rendered_size = view.getSize();
+        m_rendered_rotation = view.getRotation();
+    }
+    m_frames_since_refresh++;
+    return refresh;
+}
+
+void Camera::updateSprite() {
+    if (m_render_texture->getSize().x == 0 || m_render_texture->getSize().y == 0)
+        return;
     m_sprite.setScale(
         Settings::getConfig().getViewSize().x*m_base_viewport.width / m_render_texture->getSize().x,
         Settings::getConfig().getViewSize().y*m_base_viewport.height / m_render_texture->getSize().y
     );
     m_sprite.setPosition(m_base_viewport.left*Settings::getConfig().getViewSize().x, m_base_viewport.top*Settings::getConfig().getViewSize().y);
-    target.draw(m_sprite, getShader());
+}
+
+auto Camera::needsRefresh(const sf::View& view) const -> bool {
+    if (m_dirty || m_rendered_scene != m_scene)
+        return true;
+    switch (m_refresh_policy) {
+        case RefreshPolicy::EveryNFrames:
+            return m_frames_since_refresh >= m_refresh_frames;
+        case RefreshPolicy::OnDirty:
+            return m_rendered_version != m_scene->getVersion()
+                || m_rendered_center != view.getCenter()
+                || m_rendered_size != view.getSize()
+                || m_rendered_rotation != view.getRotation();
+        default:
+            return true;
+    }
+}
+
+auto Camera::canRenderDirectly(const sf::Vector2u& target_size, const sf::FloatRect& target_vport) const -> bool {
+    if (!Settings::getConfig().direct_rendering || getShader() != nullptr)
+        return false;
+    // size in pixels of the camera content on the target, must be a multiple of the render texture size
+    auto scale_x = static_cast<float>(target_size.x)*target_vport.width*m_base_viewport.width / static_cast<float>(m_render_texture->getSize().x);
+    auto scale_y = static_cast<float>(target_size.y)*target_vport.height*m_base_viewport.height / static_cast<float>(m_render_texture->getSize().y);
+    auto is_integer = [](float value) { return value >= 1.f && std::abs(value - std::round(value)) < 1e-3f; };
+    return is_integer(scale_x) && is_integer(scale_y);
 }
 
 auto Camera::getSprite() const -> const sf::Sprite& {
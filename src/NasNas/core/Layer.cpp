@@ -2,28 +2,122 @@
 * Created by Modar Nasser on 15/04/2020.
 **/
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include <NasNas/core/Layer.hpp>
 
 using namespace ns;
 
+namespace {
+    using SortKey = std::pair<std::uint32_t, std::uint32_t>;
+
+    // maps a float to an unsigned integer with the same ordering
+    inline auto floatKey(float value) -> std::uint32_t {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+    }
+
+    // stable LSD radix sort on the first member of the pairs, 8 bits per pass
+    void radixSort(std::vector<SortKey>& keys, std::vector<SortKey>& tmp) {
+        tmp.resize(keys.size());
+        for (unsigned shift = 0; shift < 32; shift += 8) {
+            std::size_t offsets[257] = {};
+            for (const auto& key : keys)
+                offsets[((key.first >> shift) & 0xffu) + 1]++;
+            // all the keys have the same digit, nothing to do for this pass
+            if (offsets[((keys.front().first >> shift) & 0xffu) + 1] == keys.size())
+                continue;
+            for (std::size_t i = 1; i < 257; ++i)
+                offsets[i] += offsets[i-1];
+            for (const auto& key : keys)
+                tmp[offsets[(key.first >> shift) & 0xffu]++] = key;
+            keys.swap(tmp);
+        }
+    }
+}
+
 Layer::Layer(std::string name) : m_name(std::move(name))
 {}
 
 void Layer::clear() {
+    m_records.clear();
     m_drawables.clear();
     m_gc.clear();
-    m_position_getters.clear();
-    m_bounds_getters.clear();
+    m_ids.clear();
+    m_indices.clear();
+    m_free_ids.clear();
+    if (m_spatial_index)
+        m_spatial_index->clear();
+    m_version++;
+}
+
+auto Layer::ySort() -> std::size_t {
+    if (m_records.empty())
+        return 0;
+    m_sort_keys.resize(m_records.size());
+    for (std::uint32_t i = 0; i < m_records.size(); ++i) {
+        auto& record = m_records[i];
+        record.sort_key = record.position_getter(record.object).y;
+        m_sort_keys[i] = {floatKey(record.sort_key), i};
+    }
+
+    if (m_ysort_mode == YSortMode::Full || !incrementalSort())
+        fullSort();
+    auto moved = applyOrder();
+    if (moved > 0)
+        m_version++;
+    return moved;
+}
+
+void Layer::setYSortMode(YSortMode mode) {
+    m_ysort_mode = mode;
 }
 
-void Layer::ySort() {
-    std::sort(std::begin(m_drawables), std::end(m_drawables),
-                [this](auto const lhs, auto const rhs){
-                    return m_position_getters[lhs]().y < m_position_getters[rhs]().y;
-                }
-    );
+auto Layer::getYSortMode() const -> YSortMode {
+    return m_ysort_mode;
+}
+
+void Layer::enableSpatialIndex(float cell_size) {
+    m_spatial_index = std::make_unique<SpatialGrid<std::uint32_t>>(cell_size);
+    for (auto& record : m_records) {
+        record.bounds = record.bounds_getter(record.object);
+        m_spatial_index->insert(record.id, record.bounds);
+    }
+}
+
+void Layer::disableSpatialIndex() {
+    m_spatial_index.reset();
+}
+
+auto Layer::hasSpatialIndex() const -> bool {
+    return m_spatial_index != nullptr;
+}
+
+void Layer::updateBounds(const sf::Drawable* dr) {
+    auto it = m_ids.find(dr);
+    if (it == m_ids.end())
+        return;
+    refreshBounds(m_records[m_indices[it->second]]);
+}
+
+void Layer::updateBounds() {
+    for (auto& record : m_records)
+        refreshBounds(record);
+}
+
+void Layer::markDirty() {
+    m_version++;
+}
+
+auto Layer::getVersion() const -> std::uint64_t {
+    return m_version;
+}
+
+void Layer::getDrawablesIn(const sf::FloatRect& area, std::vector<const sf::Drawable*>& result) const {
+    forEachRecordIn(area, [&result](const Record& record) { result.push_back(record.drawable); });
 }
 
 auto Layer::allDrawables() const -> const std::vector<const sf::Drawable*>& {
@@ -31,19 +125,150 @@ auto Layer::allDrawables() const -> const std::vector<const sf::Drawable*>& {
 }
 
 auto Layer::getDrawablePosition(const sf::Drawable* dr) const -> sf::Vector2f {
-    if (m_position_getters.find(dr) != m_position_getters.end()) {
-        return m_position_getters.at(dr)();
-    }
+    if (const auto* record = findRecord(dr))
+        return record->position_getter(record->object);
     return {};
 }
 
 auto Layer::getDrawableBounds(const sf::Drawable* dr) const -> sf::FloatRect {
-    if (m_bounds_getters.find(dr) != m_bounds_getters.end()) {
-        return m_bounds_getters.at(dr)();
-    }
+    if (const auto* record = findRecord(dr))
+        return record->bounds_getter(record->object);
     return {};
 }
 
+void Layer::setTextureSorting(bool value) {
+    m_texture_sorting = value;
+    m_version++;
+}
+
+auto Layer::hasTextureSorting() const -> bool {
+    return m_texture_sorting;
+}
+
+void Layer::setInterpolation(bool value) {
+    m_interpolation = value;
+    savePreviousState();
+}
+
+auto Layer::hasInterpolation() const -> bool {
+    return m_interpolation;
+}
+
+void Layer::savePreviousState() {
+    for (auto& record : m_records)
+        if (record.has_position)
+            record.previous_position = record.position_getter(record.object);
+}
+
 auto Layer::getName() const -> const std::string& {
     return m_name;
 }
+
+void Layer::addRecord(const Record& record) {
+    if (m_ids.find(record.drawable) != m_ids.end()) {
+        std::cout << "Warning : trying to add a drawable already in the Layer.\n";
+        return;
+    }
+    auto& rec = m_records.emplace_back(record);
+    rec.bounds = rec.bounds_getter(rec.object);
+    rec.sort_key = rec.position_getter(rec.object).y;
+    rec.previous_position = rec.position_getter(rec.object);
+    if (m_free_ids.empty()) {
+        rec.id = static_cast<std::uint32_t>(m_indices.size());
+        m_indices.emplace_back();
+    }
+    else {
+        rec.id = m_free_ids.back();
+        m_free_ids.pop_back();
+    }
+    m_indices[rec.id] = static_cast<std::uint32_t>(m_records.size() - 1);
+    m_ids[rec.drawable] = rec.id;
+    m_drawables.push_back(rec.drawable);
+    if (m_spatial_index)
+        m_spatial_index->insert(rec.id, rec.bounds);
+    m_version++;
+}
+
+auto Layer::removeRecord(const sf::Drawable* dr) -> bool {
+    auto it = m_ids.find(dr);
+    if (it == m_ids.end())
+        return false;
+    const auto id = it->second;
+    const auto index = m_indices[id];
+    if (m_spatial_index)
+        m_spatial_index->remove(id);
+    m_records.erase(m_records.begin() + index);
+    m_drawables.erase(m_drawables.begin() + index);
+    for (auto i = index; i < m_records.size(); ++i)
+        m_indices[m_records[i].id] = i;
+    m_free_ids.push_back(id);
+    m_ids.erase(it);
+    m_version++;
+    return true;
+}
+
+void Layer::refreshBounds(Record& record) {
+    auto bounds = record.bounds_getter(record.object);
+    if (bounds == record.bounds)
+        return;
+    record.bounds = bounds;
+    if (m_spatial_index)
+        m_spatial_index->update(record.id, record.bounds);
+    m_version++;
+}
+
+auto Layer::findRecord(const sf::Drawable* dr) const -> const Record* {
+    auto it = m_ids.find(dr);
+    if (it == m_ids.end())
+        return nullptr;
+    return &m_records[m_indices[it->second]];
+}
+
+void Layer::fullSort() {
+    if (m_sort_keys.size() > RadixSortThreshold)
+        radixSort(m_sort_keys, m_sort_tmp);
+    else
+        std::stable_sort(m_sort_keys.begin(), m_sort_keys.end(),
+                         [](const SortKey& lhs, const SortKey& rhs) { return lhs.first < rhs.first; }
+        );
+}
+
+auto Layer::incrementalSort() -> bool {
+    // insertion sort, linear on an almost sorted array
+    const auto max_shifts = IncrementalSortMaxShifts * m_sort_keys.size();
+    std::size_t shifts = 0;
+    for (std::size_t i = 1; i < m_sort_keys.size(); ++i) {
+        auto key = m_sort_keys[i];
+        auto j = i;
+        while (j > 0 && key.first < m_sort_keys[j-1].first) {
+            m_sort_keys[j] = m_sort_keys[j-1];
+            --j;
+        }
+        m_sort_keys[j] = key;
+        shifts += i - j;
+        // too much disorder, the remaining of the array is left for a full sort
+        if (shifts > max_shifts)
+            return false;
+    }
+    return true;
+}
+
+auto Layer::applyOrder() -> std::size_t {
+    // m_sort_keys holds the previous index of the records, in their new order
+    std::size_t moved = 0;
+    for (std::uint32_t i = 0; i < m_sort_keys.size(); ++i)
+        moved += m_sort_keys[i].second != i;
+    if (moved == 0)
+        return 0;
+
+    m_records_tmp.clear();
+    m_records_tmp.reserve(m_records.size());
+    for (const auto& key : m_sort_keys)
+        m_records_tmp.push_back(m_records[key.second]);
+    m_records.swap(m_records_tmp);
+    for (std::uint32_t i = 0; i < m_records.size(); ++i) {
+        m_drawables[i] = m_records[i].drawable;
+        m_indices[m_records[i].id] = i;
+    }
+    return moved;
+}
@@ -20,6 +20,8 @@ void Scene::deleteLayer(const std::string& name) {
     for (auto it = m_layers.begin(); it != m_layers.end(); ++it) {
         if (it->getName() == name) {
             it->clear();
+            // keeps the version increasing when the layer version is removed from the sum
+            m_version += it->getVersion() + 1;
             m_layers.erase(it);
             break;
         }
@@ -39,22 +41,56 @@ auto Scene::getDefaultLayer() -> Layer& {
     return m_default_layer;
 }
 
-void Scene::temporaryLinkCamera(Camera* camera) {
-    m_render_bounds = camera->getGlobalBounds();
+void Scene::temporaryLinkCamera(const sf::View& view, float alpha) {
+    m_render_bounds = {view.getCenter() - view.getSize()/2.f, view.getSize()};
+    m_alpha = alpha;
+}
+
+void Scene::setBatching(bool value) {
+    m_batching = value;
+    m_version++;
+}
+
+auto Scene::isBatching() const -> bool {
+    return m_batching;
+}
+
+auto Scene::getVersion() const -> std::uint64_t {
+    auto version = m_version + m_default_layer.getVersion();
+    for (const auto& layer : m_layers)
+        version += layer.getVersion();
+    return version;
+}
+
+auto Scene::getRenderQueue() const -> const RenderQueue& {
+    return m_render_queue;
 }
 
 void Scene::draw(sf::RenderTarget& target, sf::RenderStates states) const {
-    drawLayer(target, states, m_default_layer);
+    m_render_queue.clear();
+    queueLayers(m_render_queue);
+    m_render_queue.flush(target, states);
+}
 
+void Scene::queueLayers(RenderQueue& queue) const {
+    std::uint16_t order = 0;
+    queueLayer(queue, m_default_layer, order++);
     for (const auto& layer : m_layers) {
-        drawLayer(target, states, layer);
+        queueLayer(queue, layer, order++);
     }
 }
 
-void Scene::drawLayer(sf::RenderTarget& target, sf::RenderStates& states, const ns::Layer& layer) const {
-    for (const auto* drawable : layer.allDrawables()) {
-        if (m_render_bounds.intersects(layer.getDrawableBounds(drawable))) {
-            target.draw(*drawable, states);
-        }
-    }
+void Scene::queueLayer(RenderQueue& queue, const ns::Layer& layer, std::uint16_t order) const {
+    const auto unordered = layer.hasTextureSorting();
+    const auto interpolate = layer.hasInterpolation() && m_alpha < 1.f;
+    layer.forEachRecordIn(m_render_bounds, [&](const Layer::Record& record) {
+        // drawables are moved back toward their previous position
+        sf::Vector2f offset;
+        if (interpolate && record.has_position)
+            offset = (record.previous_position - record.position_getter(record.object)) * (1.f - m_alpha);
+        if (m_batching && record.batch)
+            queue.push(order, record.drawable, record.object, record.batch, record.texture_getter(record.object), unordered, offset);
+        else
+            queue.push(order, record.drawable, unordered, offset);
+    });
 }
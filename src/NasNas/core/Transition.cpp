@@ -18,7 +18,8 @@ Transition::Transition() :
 m_end_callback([](){})
 {
     auto texture_size = sf::Vector2u(ns::Settings::getConfig().getViewSize());
-    m_render_texture.create(texture_size.x, texture_size.y);
+    if (!ns::Settings::getConfig().headless)
+        m_render_texture.create(texture_size.x, texture_size.y);
 }
 
 void Transition::start() {
@@ -0,0 +1,108 @@
+#include <NasNas/core/UpdateScheduler.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ns;
+
+UpdateScheduler::UpdateScheduler(int update_rate) :
+m_nominal_rate(std::max(1, update_rate)),
+m_rate(m_nominal_rate),
+m_slice(1.f / static_cast<float>(m_rate)),
+m_accumulator(m_slice)
+{
+    m_last.update_rate = m_rate;
+}
+
+void UpdateScheduler::setUpdateRate(int update_rate) {
+    m_nominal_rate = std::max(1, update_rate);
+    m_rate = m_nominal_rate;
+    m_slice = 1.f / static_cast<float>(m_rate);
+}
+
+auto UpdateScheduler::getUpdateRate() const -> int {
+    return m_rate;
+}
+
+auto UpdateScheduler::getSliceTime() const -> float {
+    return m_slice;
+}
+
+void UpdateScheduler::setMaxCatchUpSteps(unsigned steps) {
+    m_max_steps = std::max(1u, steps);
+}
+
+auto UpdateScheduler::getMaxCatchUpSteps() const -> unsigned {
+    return m_max_steps;
+}
+
+void UpdateScheduler::setDynamicUpdateRate(bool value, int min_update_rate) {
+    m_dynamic = value;
+    m_min_rate = std::clamp(min_update_rate, 1, m_nominal_rate);
+    if (!m_dynamic)
+        setUpdateRate(m_nominal_rate);
+}
+
+auto UpdateScheduler::hasDynamicUpdateRate() const -> bool {
+    return m_dynamic;
+}
+
+void UpdateScheduler::beginFrame(float dt) {
+    m_accumulator += dt;
+    m_frame_steps = 0;
+    m_second_time += dt;
+    if (m_second_time >= 1.f)
+        endSecond();
+}
+
+auto UpdateScheduler::step() -> bool {
+    if (m_accumulator < m_slice)
+        return false;
+    if (m_frame_steps < m_max_steps) {
+        m_accumulator -= m_slice;
+        if (m_frame_steps > 0)
+            m_current.late++;
+        m_frame_steps++;
+        m_current.updates++;
+        return true;
+    }
+    // catch up limit reached, the simulation falls behind real time
+    auto skipped = static_cast<unsigned>(m_accumulator / m_slice);
+    auto dropped = static_cast<float>(skipped) * m_slice;
+    m_accumulator -= dropped;
+    m_current.skipped += skipped;
+    m_current.dropped_time += dropped;
+    m_total_dropped += dropped;
+    return false;
+}
+
+auto UpdateScheduler::getAlpha() const -> float {
+    return std::clamp(m_accumulator / m_slice, 0.f, 1.f);
+}
+
+auto UpdateScheduler::getTimeToNextUpdate() const -> float {
+    return std::max(0.f, m_slice - m_accumulator);
+}
+
+auto UpdateScheduler::getStats() const -> const Stats& {
+    return m_last;
+}
+
+auto UpdateScheduler::getTotalDroppedTime() const -> double {
+    return m_total_dropped;
+}
+
+void UpdateScheduler::endSecond() {
+    if (m_dynamic) {
+        auto step = std::max(1, m_rate / 10);
+        if (m_current.skipped > 0)
+            m_rate = std::max(m_min_rate, m_rate - step);
+        else if (m_current.late == 0)
+            m_rate = std::min(m_nominal_rate, m_rate + step);
+        m_slice = 1.f / static_cast<float>(m_rate);
+    }
+    m_current.update_rate = m_rate;
+    m_last = m_current;
+    m_current = Stats();
+    m_second_time = std::fmod(m_second_time, 1.f);
+}
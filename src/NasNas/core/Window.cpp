@@ -24,6 +24,13 @@ void AppWindow::onCreate() {
     scaleView();
 }
 
+void AppWindow::close() {
+    if (m_defer_close)
+        m_close_requested = true;
+    else
+        sf::RenderWindow::close();
+}
+
 void AppWindow::onResize() {
     scaleView();
 }
@@ -0,0 +1,340 @@
+#include <NasNas/core/data/FileWatcher.hpp>
+
+#include <algorithm>
+
+#include <NasNas/core/data/ThreadPool.hpp>
+
+#ifndef __ANDROID__
+#include <filesystem>
+#endif
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace ns;
+
+namespace {
+    auto isInside(const std::string& path, const std::string& directory) -> bool {
+        return path.size() > directory.size() && path.compare(0, directory.size(), directory) == 0 && path[directory.size()] == '/';
+    }
+}
+
+class FileWatcher::Backend {
+public:
+    virtual ~Backend() = default;
+    virtual auto isPolling() const -> bool = 0;
+    virtual void add(const std::string& path, bool directory) = 0;
+    /// Stops watching what the removed watch needed and none of the remaining watches do
+    virtual void remove(const Watch& removed, const std::vector<Watch>& watches) = 0;
+    virtual void poll(const std::vector<Watch>& watches, std::vector<std::string>& changed) = 0;
+};
+
+#ifndef __ANDROID__
+
+namespace {
+    namespace fs = std::filesystem;
+
+    auto normalize(const std::string& path) -> std::string {
+        std::error_code error;
+        auto absolute = fs::absolute(path, error);
+        auto normalized = (error ? fs::path(path) : absolute).lexically_normal().generic_string();
+        if (normalized.size() > 1 && normalized.back() == '/')
+            normalized.pop_back();
+        return normalized;
+    }
+}
+
+class FileWatcher::PollingBackend : public FileWatcher::Backend {
+public:
+    auto isPolling() const -> bool override {
+        return true;
+    }
+
+    void add(const std::string& path, bool directory) override {
+        scan(path, directory, nullptr);
+    }
+
+    void remove(const Watch& removed, const std::vector<Watch>& watches) override {
+        for (auto it = m_times.begin(); it != m_times.end();) {
+            const auto& file = it->first;
+            const bool was_watched = removed.directory ? isInside(file, removed.path) : file == removed.path;
+            const bool watched = std::any_of(watches.begin(), watches.end(), [&](const Watch& w) {
+                return w.directory ? isInside(file, w.path) : file == w.path;
+            });
+            if (was_watched && !watched)
+                it = m_times.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    void poll(const std::vector<Watch>& watches, std::vector<std::string>& changed) override {
+        for (const auto& watch : watches)
+            scan(watch.path, watch.directory, &changed);
+    }
+
+private:
+    void scan(const std::string& path, bool directory, std::vector<std::string>* changed) {
+        std::error_code error;
+        auto check = [&](const fs::path& file) {
+            auto time = fs::last_write_time(file, error);
+            if (error)
+                return;
+            auto key = file.generic_string();
+            auto it = m_times.find(key);
+            if (it == m_times.end())
+                m_times.emplace(key, time);
+            else if (it->second != time)
+                it->second = time;
+            else
+                return;
+            // files seen for the first time while adding the watch are not changes
+            if (changed != nullptr)
+                changed->push_back(key);
+        };
+        if (!directory) {
+            check(path);
+            return;
+        }
+        for (auto it = fs::recursive_directory_iterator(path, error); !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+            if (it->is_regular_file(error))
+                check(it->path());
+        }
+    }
+
+    std::unordered_map<std::string, fs::file_time_type> m_times;
+};
+
+#endif
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+class FileWatcher::InotifyBackend : public FileWatcher::Backend {
+public:
+    InotifyBackend() : m_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    {}
+
+    ~InotifyBackend() override {
+        if (m_fd >= 0)
+            close(m_fd);
+    }
+
+    auto isValid() const -> bool {
+        return m_fd >= 0;
+    }
+
+    auto isPolling() const -> bool override {
+        return false;
+    }
+
+    void add(const std::string& path, bool directory) override {
+        // files are replaced by editors, their directory is watched instead of their inode
+        if (!directory) {
+            addDirectory(fs::path(path).parent_path().generic_string(), false);
+            return;
+        }
+        addDirectory(path, true);
+        std::error_code error;
+        for (auto it = fs::recursive_directory_iterator(path, error); !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+            if (it->is_directory(error))
+                addDirectory(it->path().generic_string(), true);
+        }
+    }
+
+    void remove(const Watch& removed, const std::vector<Watch>& watches) override {
+        const auto removed_dir = removed.directory ? removed.path : fs::path(removed.path).parent_path().generic_string();
+        for (auto it = m_dirs.begin(); it != m_dirs.end();) {
+            const auto& dir = it->second.path;
+            if (dir != removed_dir && !(removed.directory && isInside(dir, removed_dir))) {
+                ++it;
+                continue;
+            }
+            // a directory is still needed by the file watches in it, and recursively by the directory watches above it
+            bool needed = false, recursive = false;
+            for (const auto& watch : watches) {
+                if (watch.directory && (dir == watch.path || isInside(dir, watch.path)))
+                    needed = recursive = true;
+                else if (!watch.directory && fs::path(watch.path).parent_path().generic_string() == dir)
+                    needed = true;
+            }
+            if (needed) {
+                it->second.recursive = recursive;
+                ++it;
+            }
+            else {
+                // the IN_IGNORED event that follows is skipped since the descriptor is no longer known
+                inotify_rm_watch(m_fd, it->first);
+                it = m_dirs.erase(it);
+            }
+        }
+    }
+
+    void poll(const std::vector<Watch>&, std::vector<std::string>& changed) override {
+        alignas(inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(m_fd, buffer, sizeof(buffer))) > 0) {
+            for (char* it = buffer; it < buffer + length;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(it);
+                it += sizeof(inotify_event) + event->len;
+                auto dir = m_dirs.find(event->wd);
+                if (dir == m_dirs.end())
+                    continue;
+                if (event->mask & IN_IGNORED) {
+                    m_dirs.erase(dir);
+                    continue;
+                }
+                if (event->len == 0)
+                    continue;
+                auto path = dir->second.path + "/" + event->name;
+                if (event->mask & IN_ISDIR) {
+                    if (dir->second.recursive && (event->mask & (IN_CREATE | IN_MOVED_TO)))
+                        addDirectory(path, true);
+                }
+                else {
+                    changed.push_back(std::move(path));
+                }
+            }
+        }
+    }
+
+private:
+    struct WatchedDir {
+        std::string path;
+        bool recursive = false;
+    };
+
+    void addDirectory(const std::string& path, bool recursive) {
+        const auto wd = inotify_add_watch(m_fd, path.c_str(), IN_CLOSE_WRITE | IN_MODIFY | IN_MOVED_TO | IN_CREATE);
+        if (wd < 0)
+            return;
+        auto& dir = m_dirs[wd];
+        dir.path = path;
+        dir.recursive |= recursive;
+    }
+
+    int m_fd;
+    std::unordered_map<int, WatchedDir> m_dirs;
+};
+
+#endif
+
+FileWatcher::FileWatcher() {
+#if defined(__linux__) && !defined(__ANDROID__)
+    auto inotify = std::make_unique<InotifyBackend>();
+    if (inotify->isValid())
+        m_backend = std::move(inotify);
+    else
+        m_backend = std::make_unique<PollingBackend>();
+#elif !defined(__ANDROID__)
+    m_backend = std::make_unique<PollingBackend>();
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+    // the workers may still use the callbacks
+    for (auto& pending : m_applies)
+        pending.apply.wait();
+}
+
+auto FileWatcher::getDefault() -> FileWatcher& {
+    static FileWatcher instance;
+    return instance;
+}
+
+auto FileWatcher::watch(const std::string& path, Callback callback) -> std::size_t {
+    return addWatch(path, std::move(callback), nullptr);
+}
+
+auto FileWatcher::watchAsync(const std::string& path, AsyncCallback callback) -> std::size_t {
+    return addWatch(path, nullptr, std::move(callback));
+}
+
+void FileWatcher::unwatch(std::size_t id) {
+    auto it = std::find_if(m_watches.begin(), m_watches.end(), [&](const Watch& w) { return w.id == id; });
+    if (it == m_watches.end())
+        return;
+    auto removed = std::move(*it);
+    m_watches.erase(it);
+    if (m_backend != nullptr)
+        m_backend->remove(removed, m_watches);
+}
+
+void FileWatcher::setDebounceDelay(std::chrono::milliseconds delay) {
+    m_debounce = delay;
+}
+
+void FileWatcher::setPollingInterval(std::chrono::milliseconds interval) {
+    m_polling_interval = interval;
+}
+
+auto FileWatcher::isPolling() const -> bool {
+    return m_backend != nullptr && m_backend->isPolling();
+}
+
+void FileWatcher::update() {
+    if (m_backend == nullptr || (m_watches.empty() && m_applies.empty()))
+        return;
+
+    const auto now = Clock::now();
+    if (!m_backend->isPolling() || now - m_last_poll >= m_polling_interval) {
+        std::vector<std::string> changed;
+        m_backend->poll(m_watches, changed);
+        m_last_poll = now;
+        for (const auto& path : changed)
+            m_changes[path] = now;
+    }
+
+    for (auto it = m_changes.begin(); it != m_changes.end();) {
+        if (now - it->second >= m_debounce) {
+            auto path = it->first;
+            it = m_changes.erase(it);
+            dispatch(path);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // in order, a change loaded faster than a previous one waits for it
+    while (!m_applies.empty() && m_applies.front().apply.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+        auto pending = std::move(m_applies.front());
+        m_applies.erase(m_applies.begin());
+        auto apply = pending.apply.get();
+        const bool watched = std::any_of(m_watches.begin(), m_watches.end(), [&](const Watch& w) { return w.id == pending.watch_id; });
+        if (apply && watched)
+            apply();
+    }
+}
+
+auto FileWatcher::addWatch(const std::string& path, Callback callback, AsyncCallback async_callback) -> std::size_t {
+    auto& watch = m_watches.emplace_back();
+    watch.id = m_next_id++;
+    watch.callback = std::move(callback);
+    watch.async_callback = std::move(async_callback);
+#ifndef __ANDROID__
+    watch.path = normalize(path);
+    std::error_code error;
+    watch.directory = fs::is_directory(watch.path, error);
+    if (m_backend != nullptr)
+        m_backend->add(watch.path, watch.directory);
+#else
+    watch.path = path;
+    watch.directory = false;
+#endif
+    return watch.id;
+}
+
+void FileWatcher::dispatch(const std::string& path) {
+    // callbacks can add or remove watches
+    const auto watches = m_watches;
+    for (const auto& watch : watches) {
+        const bool match = watch.directory ? isInside(path, watch.path) : path == watch.path;
+        if (!match)
+            continue;
+        if (watch.callback)
+            watch.callback(path);
+        else
+            m_applies.push_back({watch.id, ThreadPool::getDefault().enqueue([callback=watch.async_callback, path] { return callback(path); })});
+    }
+}
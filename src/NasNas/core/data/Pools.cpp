@@ -0,0 +1,30 @@
+#include <NasNas/core/data/Pools.hpp>
+
+using namespace ns;
+
+Allocations::Counters Allocations::m_current;
+Allocations::Counters Allocations::m_total;
+Allocations::Stats Allocations::m_last_frame;
+
+auto Allocations::getFrameStats() -> Stats {
+    return m_last_frame;
+}
+
+auto Allocations::getTotalStats() -> Stats {
+    return {m_total.objects.load(), m_total.allocations.load(), m_total.bytes.load()};
+}
+
+void Allocations::newFrame() {
+    m_last_frame.objects = m_current.objects.exchange(0);
+    m_last_frame.allocations = m_current.allocations.exchange(0);
+    m_last_frame.bytes = m_current.bytes.exchange(0);
+}
+
+void Allocations::record(std::size_t objects, std::size_t allocations, std::size_t bytes) {
+    m_current.objects.fetch_add(objects, std::memory_order_relaxed);
+    m_current.allocations.fetch_add(allocations, std::memory_order_relaxed);
+    m_current.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    m_total.objects.fetch_add(objects, std::memory_order_relaxed);
+    m_total.allocations.fetch_add(allocations, std::memory_order_relaxed);
+    m_total.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
@@ -0,0 +1,96 @@
+#include <NasNas/core/data/Random.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using namespace ns::utils;
+
+namespace {
+    std::atomic<std::uint64_t> global_seed{Random::DefaultSeed};
+    std::atomic<std::uint64_t> threads_count{0};
+
+    struct ThreadGenerator {
+        std::uint64_t stream = threads_count++;
+        Random generator{global_seed, stream};
+    };
+
+    thread_local ThreadGenerator thread_generator;
+
+    // integer hash with a low bias, see https://nullprogram.com/blog/2018/07/31/
+    inline auto hash(std::uint32_t x) -> std::uint32_t {
+        x ^= x >> 16;
+        x *= 0x7feb352dU;
+        x ^= x >> 15;
+        x *= 0x846ca68bU;
+        x ^= x >> 16;
+        return x;
+    }
+
+    // min + (max - min) * unit can be rounded up to max, the last float before it is returned instead
+    auto excludeMax(float value, float min, float max) -> float {
+        const auto last = std::nextafter(max, min);
+        return max > min ? std::min(value, last) : std::max(value, last);
+    }
+}
+
+Random::Random(std::uint64_t seed, std::uint64_t stream) {
+    this->seed(seed, stream);
+}
+
+void Random::seed(std::uint64_t seed, std::uint64_t stream) {
+    m_state = 0;
+    m_increment = (stream << 1u) | 1u;
+    next();
+    m_state += seed;
+    next();
+}
+
+auto Random::next() -> std::uint32_t {
+    auto old_state = m_state;
+    m_state = old_state * 6364136223846793005ULL + m_increment;
+    auto xor_shifted = static_cast<std::uint32_t>(((old_state >> 18u) ^ old_state) >> 27u);
+    auto rotation = static_cast<std::uint32_t>(old_state >> 59u);
+    return (xor_shifted >> rotation) | (xor_shifted << ((-rotation) & 31u));
+}
+
+auto Random::uniform(float min, float max) -> float {
+    // 24 bits of randomness, the float mantissa size
+    return excludeMax(min + static_cast<float>(next() >> 8u) * 0x1p-24f * (max - min), min, max);
+}
+
+auto Random::uniform(int min, int max) -> int {
+    if (max <= min)
+        return min;
+    // Lemire's multiply and shift method, rejects the few values that would bias the result
+    auto range = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min);
+    auto product = static_cast<std::uint64_t>(next()) * range;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        auto threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(next()) * range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<int>(min + static_cast<std::int64_t>(product >> 32u));
+}
+
+void Random::fillUniform(float* output, std::size_t count, float min, float max) {
+    const auto key = next();
+    const auto counter = next();
+    const auto scale = (max - min) * 0x1p-24f;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto bits = hash((counter + static_cast<std::uint32_t>(i)) ^ key);
+        output[i] = excludeMax(min + static_cast<float>(bits >> 8u) * scale, min, max);
+    }
+}
+
+auto Random::get() -> Random& {
+    return thread_generator.generator;
+}
+
+void ns::utils::setRandomSeed(std::uint64_t seed) {
+    global_seed = seed;
+    thread_generator.generator.seed(seed, thread_generator.stream);
+}
@@ -4,10 +4,91 @@
 
 #include <NasNas/core/data/ShaderHolder.hpp>
 
+#include <fstream>
+#include <sstream>
+#include <vector>
+
 #include <SFML/Graphics/Shader.hpp>
 
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/FileWatcher.hpp>
+
 using namespace ns;
 
+class ShaderHolder::LoadedShader {
+public:
+    LoadedShader(std::string vertex_file, std::string fragment_file) :
+    m_vertex_file(std::move(vertex_file)),
+    m_fragment_file(std::move(fragment_file))
+    {}
+
+    ~LoadedShader() {
+        for (auto id : m_watches)
+            FileWatcher::getDefault().unwatch(id);
+    }
+
+    auto load() -> bool {
+        if (Settings::getConfig().headless)
+            return true;
+        if (m_vertex_file.empty())
+            return shader.loadFromFile(m_fragment_file, sf::Shader::Fragment);
+        if (m_fragment_file.empty())
+            return shader.loadFromFile(m_vertex_file, sf::Shader::Vertex);
+        return shader.loadFromFile(m_vertex_file, m_fragment_file);
+    }
+
+    void watch() {
+        for (const auto* file : {&m_vertex_file, &m_fragment_file}) {
+            if (file->empty())
+                continue;
+            m_watches.push_back(FileWatcher::getDefault().watchAsync(*file, [this, vertex_file=m_vertex_file, fragment_file=m_fragment_file](const std::string&) {
+                auto vertex = std::make_shared<std::string>();
+                auto fragment = std::make_shared<std::string>();
+                if (!read(vertex_file, *vertex) || !read(fragment_file, *fragment))
+                    return std::function<void()>();
+                return std::function<void()>([this, vertex, fragment] { reload(*vertex, *fragment); });
+            }));
+        }
+    }
+
+    sf::Shader shader;
+
+private:
+    static auto read(const std::string& file, std::string& source) -> bool {
+        if (file.empty())
+            return true;
+        std::ifstream stream(file);
+        if (!stream)
+            return false;
+        std::stringstream buffer;
+        buffer << stream.rdbuf();
+        source = buffer.str();
+        return true;
+    }
+
+    static auto compile(sf::Shader& shader, const std::string& vertex, const std::string& fragment) -> bool {
+        if (vertex.empty())
+            return shader.loadFromMemory(fragment, sf::Shader::Fragment);
+        if (fragment.empty())
+            return shader.loadFromMemory(vertex, sf::Shader::Vertex);
+        return shader.loadFromMemory(vertex, fragment);
+    }
+
+    void reload(const std::string& vertex, const std::string& fragment) {
+        if (Settings::getConfig().headless)
+            return;
+        // a shader failing to compile would replace the working one by an empty program
+        sf::Shader test;
+        if (!compile(test, vertex, fragment))
+            return;
+        compile(shader, vertex, fragment);
+    }
+
+    std::string m_vertex_file;
+    std::string m_fragment_file;
+    std::vector<std::size_t> m_watches;
+};
+
 void ShaderHolder::setShader(sf::Shader* shader) {
     m_shader = shader;
 }
@@ -30,3 +111,15 @@ void ShaderHolder::toggleShader() {
 void ShaderHolder::clearShader() {
     m_shader = nullptr;
 }
+
+auto ShaderHolder::loadShader(const std::string& vertex_file, const std::string& fragment_file) -> bool {
+    auto loaded_shader = std::make_shared<LoadedShader>(vertex_file, fragment_file);
+    if (!loaded_shader->load())
+        return false;
+    if (Settings::getConfig().hot_reload)
+        loaded_shader->watch();
+    m_loaded_shader = std::move(loaded_shader);
+    m_saved_shared = nullptr;
+    m_shader = &m_loaded_shader->shader;
+    return true;
+}
@@ -0,0 +1,95 @@
+#include <NasNas/core/data/ThreadPool.hpp>
+
+#include <algorithm>
+
+using namespace ns;
+
+ThreadPool::ThreadPool(unsigned workers_count) {
+    m_workers.reserve(workers_count);
+    for (unsigned i = 0; i < workers_count; ++i)
+        m_workers.emplace_back([this] { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+auto ThreadPool::getDefault() -> ThreadPool& {
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+auto ThreadPool::getWorkersCount() const -> unsigned {
+    return static_cast<unsigned>(m_workers.size());
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t chunk_size, const std::function<void(std::size_t, std::size_t, std::size_t)>& fn) {
+    if (count == 0)
+        return;
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+    const auto chunks_count = (count + chunk_size - 1) / chunk_size;
+
+    // nothing to share, run everything on the calling thread
+    if (m_workers.empty() || chunks_count == 1) {
+        for (std::size_t chunk = 0; chunk < chunks_count; ++chunk)
+            fn(chunk*chunk_size, std::min(count, (chunk+1)*chunk_size), chunk);
+        return;
+    }
+
+    // job state is shared with the helpers, they can outlive this call if they start late
+    struct Job {
+        std::atomic<std::size_t> next{0};
+        std::size_t done = 0;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto job = std::make_shared<Job>();
+
+    auto work = [job, &fn, count, chunk_size, chunks_count] {
+        std::size_t processed = 0;
+        for (auto chunk = job->next++; chunk < chunks_count; chunk = job->next++) {
+            fn(chunk*chunk_size, std::min(count, (chunk+1)*chunk_size), chunk);
+            processed++;
+        }
+        if (processed > 0) {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            job->done += processed;
+            if (job->done == chunks_count)
+                job->finished.notify_all();
+        }
+    };
+
+    const auto helpers_count = std::min<std::size_t>(m_workers.size(), chunks_count - 1);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (std::size_t i = 0; i < helpers_count; ++i)
+            m_tasks.emplace(work);
+    }
+    m_condition.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&] { return job->done == chunks_count; });
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+            if (m_stop && m_tasks.empty())
+                return;
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+    }
+}
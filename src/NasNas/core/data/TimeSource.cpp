@@ -0,0 +1,102 @@
+#include <NasNas/core/data/TimeSource.hpp>
+
+using namespace ns;
+
+TimeSource::TimeSource() : m_groups(1)
+{}
+
+auto TimeSource::getDefault() -> TimeSource& {
+    static TimeSource instance;
+    return instance;
+}
+
+void TimeSource::advance(float dt) {
+    const auto scaled = double(dt) * m_dilation;
+    for (auto& group : m_groups)
+        if (!group.paused)
+            group.time += scaled * group.dilation;
+}
+
+auto TimeSource::getTime(Group group) const -> double {
+    return group < m_groups.size() ? m_groups[group].time : m_groups[DefaultGroup].time;
+}
+
+void TimeSource::setDilation(float dilation) {
+    m_dilation = dilation;
+}
+
+auto TimeSource::getDilation() const -> float {
+    return m_dilation;
+}
+
+void TimeSource::setDilation(Group group, float dilation) {
+    getGroup(group).dilation = dilation;
+}
+
+auto TimeSource::getDilation(Group group) const -> float {
+    return group < m_groups.size() ? m_groups[group].dilation : 1.f;
+}
+
+void TimeSource::pause(Group group) {
+    getGroup(group).paused = true;
+}
+
+void TimeSource::resume(Group group) {
+    getGroup(group).paused = false;
+}
+
+auto TimeSource::isPaused(Group group) const -> bool {
+    return group < m_groups.size() && m_groups[group].paused;
+}
+
+void TimeSource::reset() {
+    for (auto& group : m_groups)
+        group.time = 0.;
+    m_epoch++;
+}
+
+auto TimeSource::getEpoch() const -> std::uint32_t {
+    return m_epoch;
+}
+
+auto TimeSource::getGroup(Group group) -> GroupState& {
+    // groups are created on first use, a new group starts at the time of the default group
+    while (m_groups.size() <= group)
+        m_groups.push_back({m_groups[DefaultGroup].time, 1.f, false});
+    return m_groups[group];
+}
+
+GameClock::GameClock(TimeSource::Group group, const TimeSource& source) :
+m_source(&source),
+m_group(group),
+m_start(source.getTime(group)),
+m_epoch(source.getEpoch())
+{}
+
+auto GameClock::getElapsedTime() const -> float {
+    return static_cast<float>(m_source->getTime(m_group) - getStart());
+}
+
+auto GameClock::restart() -> float {
+    const auto now = m_source->getTime(m_group);
+    const auto elapsed = static_cast<float>(now - getStart());
+    m_start = now;
+    m_epoch = m_source->getEpoch();
+    return elapsed;
+}
+
+void GameClock::setGroup(TimeSource::Group group, const TimeSource& source) {
+    m_source = &source;
+    m_group = group;
+    m_start = source.getTime(group);
+    m_epoch = source.getEpoch();
+}
+
+auto GameClock::getGroup() const -> TimeSource::Group {
+    return m_group;
+}
+
+auto GameClock::getStart() const -> double {
+    // the time source was reset since the clock started, the clock started with it
+    return m_epoch == m_source->getEpoch() ? m_start : 0.;
+}
@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "NasNas/core/data/Utils.hpp"
+#include "NasNas/core/data/Random.hpp"
 
 using namespace ns::utils;
 
@@ -71,11 +72,11 @@ bool_switch::operator bool() const {
 }
 
 auto ns::utils::getRandomFloat(float min, float max) -> float {
-    return min + static_cast<float>(rand()) / static_cast<float>(RAND_MAX)*(max-min);
+    return Random::get().uniform(min, max);
 }
 
 auto ns::utils::getRandomInt(int min, int max) -> int {
-    return min + rand()%(max-min);
+    return Random::get().uniform(min, max);
 }
 
 auto ns::utils::computeBounds(std::initializer_list<sf::FloatRect> rects) -> ns::FloatRect {
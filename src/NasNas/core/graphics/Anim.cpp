@@ -70,6 +70,10 @@ void AnimPlayer::resume() {
     m_clock.restart();
 }
 
+void AnimPlayer::setTimeGroup(TimeSource::Group group) {
+    m_clock.setGroup(group);
+}
+
 void AnimPlayer::pause() {
     m_playing = false;
 }
@@ -110,7 +114,7 @@ void AnimPlayer::setPlaySpeed(float speed) {
 
 void AnimPlayer::update() {
     if (m_playing) {
-        if (m_clock.getElapsedTime().asMilliseconds() > (float)m_anim->getFrame(m_index).duration / m_play_speed) {
+        if (m_clock.getElapsedTime() * 1000.f > (float)m_anim->getFrame(m_index).duration / m_play_speed) {
             m_index++;
             m_clock.restart();
             if (m_index >= m_anim->size()) {
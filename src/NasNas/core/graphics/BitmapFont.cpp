@@ -28,6 +28,9 @@ void BitmapFont::setCharacters(const std::wstring& characters) {
     m_glyphs[0] = {{0, 0, 0, 0}, static_cast<wchar_t>(0), 0};
 
     auto columns = m_texture->getSize().x / m_glyph_size.x;
+    // texture not loaded (headless app), the glyphs are laid out on a single row
+    if (columns == 0)
+        columns = static_cast<unsigned>(characters.size());
     for (unsigned i = 0; i < characters.size(); ++i) {
         auto character = characters.at(i);
         auto tex_coords = sf::Vector2i((i % columns)*m_glyph_size.x, (i / columns)*m_glyph_size.y);
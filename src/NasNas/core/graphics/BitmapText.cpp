@@ -32,6 +32,10 @@ auto BitmapText::getFont() const -> const BitmapFont* {
     return m_font;
 }
 
+auto BitmapText::getTexture() const -> const sf::Texture* {
+    return m_font ? m_font->getTexture() : nullptr;
+}
+
 void BitmapText::setFont(const BitmapFont& font) {
     m_font = &font;
     m_need_update = true;
@@ -183,6 +187,16 @@ void BitmapText::updateVertices() const {
     }
 }
 
+void BitmapText::batchTriangles(std::vector<sf::Vertex>& vertices) const {
+    if (m_font != nullptr) {
+        if (m_need_update)
+            updateVertices();
+        const auto& transform = getTransform();
+        for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
+            vertices.emplace_back(transform.transformPoint(m_vertices[i].position), m_vertices[i].color, m_vertices[i].texCoords);
+    }
+}
+
 void BitmapText::draw(sf::RenderTarget& target, sf::RenderStates states) const {
     if (m_font != nullptr) {
         states.texture = m_font->getTexture();
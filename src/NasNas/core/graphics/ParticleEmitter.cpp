@@ -0,0 +1,151 @@
+#include <NasNas/core/graphics/ParticleEmitter.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <NasNas/core/data/Maths.hpp>
+#include <NasNas/core/data/Random.hpp>
+#include <NasNas/core/graphics/ParticleSystem.hpp>
+
+using namespace ns;
+
+auto ParticleEmitter::loadFromFile(const std::string& filename) -> bool {
+    std::ifstream file(filename);
+    if (!file) {
+        std::cerr << "(ns::ParticleEmitter::loadFromFile) Could not open file " << filename << std::endl;
+        return false;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return loadFromString(content.str());
+}
+
+auto ParticleEmitter::loadFromString(const std::string& content) -> bool {
+    *this = ParticleEmitter();
+
+    std::istringstream lines(content);
+    std::string line;
+    unsigned line_number = 0;
+    while (std::getline(lines, line)) {
+        line_number++;
+        line = line.substr(0, line.find('#'));
+        auto equal_idx = line.find('=');
+        if (equal_idx == std::string::npos) {
+            if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                std::cerr << "(ns::ParticleEmitter) Line " << line_number << " is not a `key = value` pair." << std::endl;
+                return false;
+            }
+            continue;
+        }
+
+        std::string key;
+        std::istringstream(line.substr(0, equal_idx)) >> key;
+        std::istringstream value(line.substr(equal_idx+1));
+
+        auto read_range = [&](sf::Vector2f& range) {
+            value >> range.x;
+            // a single value is a range of zero width
+            if (!value.fail() && !(value >> range.y)) {
+                range.y = range.x;
+                value.clear();
+            }
+        };
+
+        if (key == "shape") {
+            std::string shape_name;
+            value >> shape_name;
+            if (shape_name == "point") shape = Shape::Point;
+            else if (shape_name == "rectangle") shape = Shape::Rectangle;
+            else if (shape_name == "circle") shape = Shape::Circle;
+            else {
+                std::cerr << "(ns::ParticleEmitter) Line " << line_number << " : unknown shape " << shape_name << std::endl;
+                return false;
+            }
+        }
+        else if (key == "shape_size") read_range(shape_size);
+        else if (key == "speed") read_range(speed);
+        else if (key == "angle") read_range(angle);
+        else if (key == "lifetime") read_range(lifetime);
+        else if (key == "rotation") read_range(rotation);
+        else if (key == "angular_velocity") read_range(angular_velocity);
+        else if (key == "scale") read_range(scale);
+        else if (key == "gravity") value >> gravity.x >> gravity.y;
+        else if (key == "drag") value >> drag;
+        else if (key == "color_over_life") {
+            float time;
+            unsigned r, g, b, a = 255;
+            value >> time >> r >> g >> b;
+            if (!value.fail() && !(value >> a)) {
+                a = 255;
+                value.clear();
+            }
+            color_over_life.addKey(time, sf::Color(r, g, b, a));
+        }
+        else if (key == "scale_over_life") {
+            float time, val;
+            value >> time >> val;
+            scale_over_life.addKey(time, val);
+        }
+        else {
+            std::cerr << "(ns::ParticleEmitter) Line " << line_number << " : unknown key " << key << std::endl;
+            return false;
+        }
+
+        if (value.fail()) {
+            std::cerr << "(ns::ParticleEmitter) Line " << line_number << " : invalid value for key " << key << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+auto ParticleEmitter::spawn(Particle& particle, float dt, utils::Random& random) const -> sf::Vector2f {
+    auto randomIn = [&random](const sf::Vector2f& range) { return random.uniform(range.x, range.y); };
+    auto direction = ns::to_radian(randomIn(angle));
+    auto initial_speed = randomIn(speed);
+    particle.velocity = {std::cos(direction)*initial_speed*dt, std::sin(direction)*initial_speed*dt};
+    // the age is divided by the lifetime to evaluate the curves
+    particle.lifetime = std::max(randomIn(lifetime), 1e-4f);
+    particle.rotation = randomIn(rotation);
+    particle.angular_velocity = randomIn(angular_velocity);
+    particle.scale = scale_over_life.empty() ? randomIn(scale) : scale_over_life.evaluate(0.f);
+    particle.color = color_over_life.empty() ? sf::Color::White : color_over_life.evaluate(0.f);
+
+    switch (shape) {
+        case Shape::Rectangle:
+            return {
+                random.uniform(-shape_size.x/2.f, shape_size.x/2.f),
+                random.uniform(-shape_size.y/2.f, shape_size.y/2.f)
+            };
+        case Shape::Circle: {
+            auto a = random.uniform(0.f, 2*ns::PI);
+            auto r = std::sqrt(random.uniform(0.f, 1.f));
+            return {std::cos(a)*r*shape_size.x, std::sin(a)*r*shape_size.y};
+        }
+        default:
+            return {0.f, 0.f};
+    }
+}
+
+void ParticleEmitter::update(Particle* const* begin, Particle* const* end, float dt) const {
+    // velocity is stored per update, gravity has to be scaled twice
+    const auto acceleration = gravity*dt*dt;
+    const auto damping = std::max(0.f, 1.f - drag*dt);
+    for (auto it = begin; it != end; ++it) {
+        auto& particle = **it;
+        particle.velocity = (particle.velocity + acceleration) * damping;
+        particle.rotation += particle.angular_velocity*dt;
+    }
+
+    if (!color_over_life.empty()) {
+        for (auto it = begin; it != end; ++it)
+            (*it)->color = color_over_life.evaluate((*it)->getAge() / (*it)->lifetime);
+    }
+
+    if (!scale_over_life.empty()) {
+        for (auto it = begin; it != end; ++it)
+            (*it)->scale = scale_over_life.evaluate((*it)->getAge() / (*it)->lifetime);
+    }
+}
@@ -2,10 +2,21 @@
 
 #include <NasNas/core/graphics/ParticleSystem.hpp>
 
+#include <NasNas/core/App.hpp>
 #include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/ThreadPool.hpp>
 
 using namespace ns;
 
+namespace {
+    // time step of the App updates, it follows the update rate when it is dynamic
+    auto getStepTime() -> float {
+        if (auto* app = detail::AppComponent::app)
+            return app->getDt();
+        return 1.f/ns::Settings::getConfig().update_rate;
+    }
+}
+
 void ParticleSystem::setTexture(const sf::Texture& texture) {
     m_texture = &texture;
 }
@@ -18,12 +29,12 @@ void ParticleSystem::emit(const sf::IntRect& rect, int nb, bool repeat) {
     m_batch.setDrawOrder(SpriteBatch::DrawOrder::Back);
     m_particles.reserve(m_particles.size()+nb);
     for (int i = 0; i < nb; ++i) {
-        auto& particle = *m_particles.emplace_back(new Particle());
-        onParticleCreate(particle);
+        auto& particle = *m_particles.emplace_back(m_pool.create());
         particle.repeat = repeat;
         particle.sprite.setTexture(*m_texture);
         particle.sprite.setTextureRect(rect);
         particle.sprite.setPosition(m_position);
+        createParticle(particle);
         particle.sprite.setOrigin(rect.width/2.f, rect.height/2.f);
         particle.sprite.setColor(sf::Color(255, 255, 255, 0));
         m_batch.draw(&particle.sprite);
@@ -35,13 +46,13 @@ void ParticleSystem::emitBurst(const sf::IntRect& rect, int nb) {
     m_batch.setDrawOrder(SpriteBatch::DrawOrder::Front);
     m_particles.reserve(m_particles.size()+nb);
     for (int i = 0; i < nb; ++i) {
-        auto& particle = *m_particles.emplace_back(new Particle());
-        onParticleCreate(particle);
+        auto& particle = *m_particles.emplace_back(m_pool.create());
         particle.active = true;
         particle.repeat = false;
         particle.sprite.setTexture(*m_texture);
         particle.sprite.setTextureRect(rect);
         particle.sprite.setPosition(m_position);
+        createParticle(particle);
         particle.sprite.setOrigin(rect.width/2.f, rect.height/2.f);
         particle.sprite.setColor(sf::Color(255, 255, 255, 0));
         m_batch.draw(&particle.sprite);
@@ -70,10 +81,33 @@ auto ParticleSystem::getGlobalBounds() const -> ns::FloatRect {
     return m_batch.getGlobalBounds();
 }
 
+void ParticleSystem::setParallel(bool value) {
+    m_parallel = value;
+}
+
+auto ParticleSystem::isParallel() const -> bool {
+    return m_parallel;
+}
+
+void ParticleSystem::setEmitter(const ParticleEmitter& emitter, bool use_hooks) {
+    m_emitter = emitter;
+    m_use_hooks = use_hooks;
+}
+
+auto ParticleSystem::getEmitter() const -> const ParticleEmitter* {
+    return m_emitter ? &m_emitter.value() : nullptr;
+}
+
+void ParticleSystem::setSeed(std::uint64_t seed) {
+    m_random.seed(seed);
+}
+
 void ParticleSystem::update() {
-    float dt = 1.f/ns::Settings::getConfig().update_rate;
+    float dt = getStepTime();
     m_to_emmit = std::min(m_rate, m_to_emmit+m_rate*dt);
 
+    // lifetime and emission are handled sequentially, they depend on the particles order
+    m_to_update.clear();
     for (auto it = m_particles.begin(); it != m_particles.end();) {
         auto& particle = **it;
 
@@ -87,21 +121,23 @@ void ParticleSystem::update() {
             }
             else {
                 m_batch.erase(&particle.sprite);
+                m_pool.destroy(&particle);
                 it = m_particles.erase(it);
             }
             m_count--;
         }
         else {
             if (particle.active) {
-                updateParticle(particle, dt); // update particle data
+                m_to_update.push_back(&particle);
             }
             else {
                 particle.sprite.setPosition(m_position);
                 if (m_to_emmit > 1.f){
                     particle.active = true;
                     particle.sprite.setColor(sf::Color::White);
-                    onParticleCreate(particle);
-                    updateParticle(particle, 0);
+                    createParticle(particle);
+                    auto* created = &particle;
+                    updateParticles(&created, &created+1, 0);
                     m_to_emmit -= 1.f;
                     m_count++;
                 }
@@ -109,16 +145,45 @@ void ParticleSystem::update() {
             it++;
         }
     }
+
+    // active particles are independent from each other and can be updated in any order
+    if (m_parallel) {
+        ThreadPool::getDefault().parallelFor(m_to_update.size(), ParallelChunkSize,
+            [&](std::size_t begin, std::size_t end, std::size_t) {
+                updateParticles(m_to_update.data()+begin, m_to_update.data()+end, dt);
+            }
+        );
+    }
+    else {
+        updateParticles(m_to_update.data(), m_to_update.data()+m_to_update.size(), dt);
+    }
 }
 
-void ParticleSystem::updateParticle(Particle& particle, float dt) {
-    onParticleUpdate(particle);
-    particle.age = particle.age+dt;
-    // update particle sprite
-    particle.sprite.move(particle.velocity);
-    particle.sprite.setScale(particle.scale, particle.scale);
-    particle.sprite.setRotation(particle.rotation);
-    particle.sprite.setColor(particle.color);
+void ParticleSystem::createParticle(Particle& particle) {
+    if (m_emitter) {
+        float dt = getStepTime();
+        particle.sprite.move(m_emitter->spawn(particle, dt, m_random));
+    }
+    if (m_use_hooks)
+        onParticleCreate(particle);
+}
+
+void ParticleSystem::updateParticles(Particle* const* begin, Particle* const* end, float dt) {
+    if (m_emitter)
+        m_emitter->update(begin, end, dt);
+    if (m_use_hooks) {
+        for (auto it = begin; it != end; ++it)
+            onParticleUpdate(**it);
+    }
+    for (auto it = begin; it != end; ++it) {
+        auto& particle = **it;
+        particle.age = particle.age+dt;
+        // update particle sprite
+        particle.sprite.move(particle.velocity);
+        particle.sprite.setScale(particle.scale, particle.scale);
+        particle.sprite.setRotation(particle.rotation);
+        particle.sprite.setColor(particle.color);
+    }
 }
 
 void ParticleSystem::draw(sf::RenderTarget& target, sf::RenderStates states) const {
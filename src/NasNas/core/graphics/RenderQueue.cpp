@@ -0,0 +1,120 @@
+#include <NasNas/core/graphics/RenderQueue.hpp>
+
+#include <algorithm>
+#include <limits>
+
+using namespace ns;
+
+void RenderQueue::clear() {
+    m_commands.clear();
+    m_texture_ranks.clear();
+    m_captured.clear();
+    m_live_commands = 0;
+}
+
+void RenderQueue::setCapturing(bool value) {
+    m_capturing = value;
+}
+
+auto RenderQueue::isCapturing() const -> bool {
+    return m_capturing;
+}
+
+void RenderQueue::push(std::uint16_t layer, const sf::Drawable* drawable, bool unordered, const sf::Vector2f& offset) {
+    m_commands.push_back({makeKey(layer, nullptr, unordered), drawable, nullptr, nullptr, nullptr, offset, 0, 0, false});
+    m_live_commands++;
+}
+
+void RenderQueue::push(std::uint16_t layer, const sf::Drawable* drawable, const void* object, BatchFunction batch, const sf::Texture* texture,
+                       bool unordered, const sf::Vector2f& offset) {
+    if (!m_capturing) {
+        m_commands.push_back({makeKey(layer, texture, unordered), drawable, object, batch, texture, offset, 0, 0, false});
+        m_live_commands++;
+        return;
+    }
+    auto first = static_cast<std::uint32_t>(m_captured.size());
+    batch(object, m_captured);
+    translate(m_captured, first, offset);
+    auto count = static_cast<std::uint32_t>(m_captured.size()) - first;
+    m_commands.push_back({makeKey(layer, texture, unordered), drawable, nullptr, nullptr, texture, {}, first, count, true});
+}
+
+void RenderQueue::flush(sf::RenderTarget& target, const sf::RenderStates& states) {
+    m_draw_calls = 0;
+    // keys are unique, no need for a stable sort
+    std::sort(m_commands.begin(), m_commands.end(), [](const Command& lhs, const Command& rhs) {
+        return lhs.key < rhs.key;
+    });
+
+    const sf::Texture* batch_texture = nullptr;
+    for (const auto& command : m_commands) {
+        if (command.batch || command.captured) {
+            if (command.texture != batch_texture)
+                drawBatch(target, states, batch_texture);
+            batch_texture = command.texture;
+            if (command.captured)
+                m_vertices.insert(m_vertices.end(), m_captured.begin() + command.first, m_captured.begin() + command.first + command.count);
+            else {
+                auto first = m_vertices.size();
+                command.batch(command.object, m_vertices);
+                translate(m_vertices, first, command.offset);
+            }
+        }
+        else {
+            drawBatch(target, states, batch_texture);
+            if (command.offset == sf::Vector2f()) {
+                target.draw(*command.drawable, states);
+            }
+            else {
+                auto moved_states = states;
+                moved_states.transform.translate(command.offset);
+                target.draw(*command.drawable, moved_states);
+            }
+            m_draw_calls++;
+        }
+    }
+    drawBatch(target, states, batch_texture);
+}
+
+auto RenderQueue::getCommandsCount() const -> std::size_t {
+    return m_commands.size();
+}
+
+auto RenderQueue::getLiveCommandsCount() const -> std::size_t {
+    return m_live_commands;
+}
+
+auto RenderQueue::getDrawCallsCount() const -> std::size_t {
+    return m_draw_calls;
+}
+
+auto RenderQueue::makeKey(std::uint16_t layer, const sf::Texture* texture, bool unordered) -> std::uint64_t {
+    // | layer : 16 bits | texture rank : 16 bits | push order : 32 bits |
+    std::uint64_t texture_rank = 0;
+    if (unordered) {
+        // ranks are given in order of first appearance to keep the result deterministic,
+        // they saturate so that textures past the 65535th share the last rank and are drawn in push order
+        constexpr std::size_t max_rank = std::numeric_limits<std::uint16_t>::max();
+        const auto rank = static_cast<std::uint16_t>(std::min(m_texture_ranks.size(), max_rank));
+        auto it = m_texture_ranks.emplace(texture, rank).first;
+        texture_rank = it->second;
+    }
+    return (std::uint64_t(layer) << 48u) | (texture_rank << 32u) | static_cast<std::uint32_t>(m_commands.size());
+}
+
+void RenderQueue::drawBatch(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Texture* texture) {
+    if (m_vertices.empty())
+        return;
+    auto batch_states = states;
+    batch_states.texture = texture;
+    target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, batch_states);
+    m_vertices.clear();
+    m_draw_calls++;
+}
+
+void RenderQueue::translate(std::vector<sf::Vertex>& vertices, std::size_t first, const sf::Vector2f& offset) {
+    if (offset == sf::Vector2f())
+        return;
+    for (auto i = first; i < vertices.size(); ++i)
+        vertices[i].position += offset;
+}
@@ -98,6 +98,14 @@ auto Sprite::getGlobalBounds() const -> ns::FloatRect {
     return getTransform().transformRect(getLocalBounds());
 }
 
+void Sprite::batchTriangles(std::vector<sf::Vertex>& vertices) const {
+    if (m_texture) {
+        const auto& transform = getTransform();
+        for (auto i : {0, 1, 2, 2, 1, 3})
+            vertices.emplace_back(transform.transformPoint(m_vertices[i].position), m_vertices[i].color, m_vertices[i].texCoords);
+    }
+}
+
 void Sprite::draw(sf::RenderTarget& target, sf::RenderStates states) const {
     if (m_texture) {
         states.transform *= getTransform();
@@ -4,6 +4,10 @@
 
 #include <NasNas/core/graphics/SpriteBatch.hpp>
 
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/ThreadPool.hpp>
+#include <NasNas/core/data/Utils.hpp>
+
 using namespace ns;
 
 
@@ -16,7 +20,8 @@ SpriteBatch::SpriteBatch() : m_usage(sf::VertexBuffer::Usage::Stream) {
 }
 
 void SpriteBatch::clear() {
-    m_gc.clear();
+    m_transients.reset();
+    m_transients_rendered = false;
     m_layers.clear();
     m_global_bounds = {0, 0, 0, 0};
 }
@@ -47,22 +52,16 @@ void SpriteBatch::draw(const ns::Sprite* sprite) {
 }
 
 void SpriteBatch::draw(const sf::Texture* texture, const sf::Vector2f& pos, const sf::IntRect& rect, const sf::Color& color) {
-    auto* spr = new ns::Sprite(*texture);
-    spr->setTextureRect(rect);
+    auto* spr = createTransient(*texture, rect, color);
     spr->setPosition(pos);
-    spr->setColor(color);
-    m_gc.emplace_back(spr);
     draw(spr);
 }
 
 void SpriteBatch::draw(const sf::Texture* texture, const sf::IntRect& rect, const sf::Transformable& tr, const sf::Color& color) {
-    auto* spr = new ns::Sprite(*texture);
-    spr->setTextureRect(rect);
+    auto* spr = createTransient(*texture, rect, color);
     spr->setPosition(tr.getPosition());
     spr->setRotation(tr.getRotation());
     spr->setScale(tr.getScale());
-    spr->setColor(color);
-    m_gc.emplace_back(spr);
     draw(spr);
 }
 
@@ -76,9 +75,12 @@ void SpriteBatch::erase(const ns::Sprite* sprite) {
 }
 
 void SpriteBatch::end() {
+    // headless apps only generate the vertices, they have no OpenGL context to upload them
+    const bool headless = Settings::getConfig().headless;
     for (auto& layer : m_layers) {
         layer.vertices.resize(layer.sprites.size()*6);
-        layer.buffer.create(layer.sprites.size()*6);
+        if (!headless)
+            layer.buffer.create(layer.sprites.size()*6);
         layer.buffer.setUsage(m_usage);
         layer.buffer.setPrimitiveType(sf::PrimitiveType::Triangles);
     }
@@ -105,63 +107,106 @@ void SpriteBatch::render() {
     if (m_usage == sf::VertexBuffer::Usage::Static && !m_need_render)
         return;
     m_need_render = false;
+    m_transients_rendered = true;
 
     if (m_need_end)
         end();
 
+    // each chunk writes its own vertices range and computes its own bounds,
+    // the bounds are then merged in chunk order on the calling thread
+    std::vector<ns::FloatRect> chunks_bounds;
+    const bool headless = Settings::getConfig().headless;
     bool first = true;
     for (auto& layer : m_layers) {
-        for (unsigned int i = 0; i < layer.sprites.size(); ++i) {
-            auto* spr = layer.sprites[i];
-
-            const auto& transform = spr->getTransform();
-            const ns::FloatRect tex_rect{spr->getTextureRect()};
-            const ns::FloatRect lb{spr->getLocalBounds()};
-            const ns::FloatRect rect{transform.transformRect(lb)};
-
-            const auto& topleft = transform.transformPoint(lb.topleft());
-            const auto& topright = transform.transformPoint(lb.topright());
-            const auto& bottomright = transform.transformPoint(lb.bottomright());
-            const auto& bottomleft = transform.transformPoint(lb.bottomleft());
-
-            layer.vertices[i*6+0].position = topleft;
-            layer.vertices[i*6+1].position = topright;
-            layer.vertices[i*6+2].position = bottomright;
-            layer.vertices[i*6+3].position = topleft;
-            layer.vertices[i*6+4].position = bottomright;
-            layer.vertices[i*6+5].position = bottomleft;
-
-            layer.vertices[i*6+0].color = spr->getColor(0);
-            layer.vertices[i*6+1].color = spr->getColor(1);
-            layer.vertices[i*6+2].color = spr->getColor(2);
-            layer.vertices[i*6+3].color = spr->getColor(0);
-            layer.vertices[i*6+4].color = spr->getColor(2);
-            layer.vertices[i*6+5].color = spr->getColor(3);
-
-            layer.vertices[i*6+0].texCoords = tex_rect.topleft();
-            layer.vertices[i*6+1].texCoords = tex_rect.topright();
-            layer.vertices[i*6+2].texCoords = tex_rect.bottomright();
-            layer.vertices[i*6+3].texCoords = tex_rect.topleft();
-            layer.vertices[i*6+4].texCoords = tex_rect.bottomright();
-            layer.vertices[i*6+5].texCoords = tex_rect.bottomleft();
-
+        const auto chunks_count = (layer.sprites.size() + ParallelChunkSize - 1) / ParallelChunkSize;
+        chunks_bounds.assign(chunks_count, {0, 0, 0, 0});
+        ThreadPool::getDefault().parallelFor(layer.sprites.size(), ParallelChunkSize,
+            [&](std::size_t begin, std::size_t end, std::size_t chunk) {
+                chunks_bounds[chunk] = renderSprites(layer, begin, end);
+            }
+        );
+        for (const auto& bounds : chunks_bounds) {
             if (first) {
-                m_global_bounds = rect;
+                m_global_bounds = bounds;
                 first = false;
             }
-            else {
-                auto left = std::min(rect.left, m_global_bounds.left);
-                auto top = std::min(rect.top, m_global_bounds.top);
-                auto right = std::max(rect.right(), m_global_bounds.right());
-                auto bottom = std::max(rect.bottom(), m_global_bounds.bottom());
-                m_global_bounds.left = left;
-                m_global_bounds.top = top;
-                m_global_bounds.width = right - left;
-                m_global_bounds.height = bottom - top;
-            }
+            else
+                m_global_bounds = utils::computeBounds({m_global_bounds, bounds});
+        }
+        if (!headless)
+            layer.buffer.update(layer.vertices.data());
+    }
+}
+
+auto SpriteBatch::renderSprites(SpriteBatchLayer& layer, std::size_t begin, std::size_t end) -> ns::FloatRect {
+    ns::FloatRect bounds;
+    for (auto i = begin; i < end; ++i) {
+        auto* spr = layer.sprites[i];
+        auto* vertices = &layer.vertices[i*6];
+
+        const auto& transform = spr->getTransform();
+        const ns::FloatRect tex_rect{spr->getTextureRect()};
+        const ns::FloatRect lb{spr->getLocalBounds()};
+        const ns::FloatRect rect{transform.transformRect(lb)};
+
+        const auto& topleft = transform.transformPoint(lb.topleft());
+        const auto& topright = transform.transformPoint(lb.topright());
+        const auto& bottomright = transform.transformPoint(lb.bottomright());
+        const auto& bottomleft = transform.transformPoint(lb.bottomleft());
+
+        vertices[0].position = topleft;
+        vertices[1].position = topright;
+        vertices[2].position = bottomright;
+        vertices[3].position = topleft;
+        vertices[4].position = bottomright;
+        vertices[5].position = bottomleft;
+
+        vertices[0].color = spr->getColor(0);
+        vertices[1].color = spr->getColor(1);
+        vertices[2].color = spr->getColor(2);
+        vertices[3].color = spr->getColor(0);
+        vertices[4].color = spr->getColor(2);
+        vertices[5].color = spr->getColor(3);
+
+        vertices[0].texCoords = tex_rect.topleft();
+        vertices[1].texCoords = tex_rect.topright();
+        vertices[2].texCoords = tex_rect.bottomright();
+        vertices[3].texCoords = tex_rect.topleft();
+        vertices[4].texCoords = tex_rect.bottomright();
+        vertices[5].texCoords = tex_rect.bottomleft();
+
+        if (i == begin) {
+            bounds = rect;
+        }
+        else {
+            auto left = std::min(rect.left, bounds.left);
+            auto top = std::min(rect.top, bounds.top);
+            auto right = std::max(rect.right(), bounds.right());
+            auto bottom = std::max(rect.bottom(), bounds.bottom());
+            bounds.left = left;
+            bounds.top = top;
+            bounds.width = right - left;
+            bounds.height = bottom - top;
+        }
+    }
+    return bounds;
+}
+
+auto SpriteBatch::createTransient(const sf::Texture& texture, const sf::IntRect& rect, const sf::Color& color) -> ns::Sprite* {
+    if (m_transients_rendered) {
+        // new frame, the transient sprites of the previous one are removed and their memory reused
+        for (auto& layer : m_layers) {
+            auto& vec = layer.sprites;
+            vec.erase(std::remove_if(vec.begin(), vec.end(), [this](const ns::Sprite* spr) { return m_transients.contains(spr); }), vec.end());
         }
-        layer.buffer.update(layer.vertices.data());
+        m_layers.remove_if([](const SpriteBatchLayer& layer) { return layer.sprites.empty(); });
+        m_transients.reset();
+        m_transients_rendered = false;
+        m_need_end = true;
     }
+    auto* spr = m_transients.create(texture, rect);
+    spr->setColor(color);
+    return spr;
 }
 
 void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
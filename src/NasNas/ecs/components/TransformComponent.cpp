@@ -2,6 +2,8 @@
 
 #include <NasNas/ecs/components/TransformComponent.hpp>
 
+#include <cmath>
+
 using namespace ns;
 using namespace ns::ecs;
 
@@ -20,3 +22,23 @@ void TransformComponent::setScaleX(float x) {
 void TransformComponent::setScaleY(float y) {
     setScale(getScale().x, y);
 }
+
+void TransformComponent::savePreviousState() {
+    m_previous_position = getPosition();
+    m_previous_rotation = getRotation();
+    m_previous_scale = getScale();
+    m_has_previous_state = true;
+}
+
+auto TransformComponent::getInterpolatedTransform(float alpha) const -> sf::Transform {
+    // the transform is not interpolated from the origin before the first save
+    if (!m_has_previous_state)
+        return getTransform();
+    sf::Transformable transformable = *this;
+    // shortest way between the two angles, rotations are kept in [0, 360)
+    auto rotation_diff = std::remainder(getRotation() - m_previous_rotation, 360.f);
+    transformable.setPosition(m_previous_position + (getPosition() - m_previous_position)*alpha);
+    transformable.setRotation(m_previous_rotation + rotation_diff*alpha);
+    transformable.setScale(m_previous_scale + (getScale() - m_previous_scale)*alpha);
+    return transformable.getTransform();
+}
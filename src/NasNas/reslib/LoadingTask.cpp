@@ -0,0 +1,148 @@
+#include <NasNas/reslib/LoadingTask.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/ThreadPool.hpp>
+
+using namespace ns;
+
+namespace {
+    template <typename T>
+    auto isReady(const std::future<T>& future) -> bool {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+}
+
+LoadingTask::~LoadingTask() {
+    join();
+}
+
+LoadingTask& LoadingTask::operator=(LoadingTask&& other) noexcept {
+    if (this != &other) {
+        join();
+        m_textures = std::move(other.m_textures);
+        m_fonts = std::move(other.m_fonts);
+        m_pending_textures = std::move(other.m_pending_textures);
+        m_pending_fonts = std::move(other.m_pending_fonts);
+        m_loaded = other.m_loaded;
+        m_failed = other.m_failed;
+        m_on_progress = std::move(other.m_on_progress);
+        other.m_pending_textures.clear();
+        other.m_pending_fonts.clear();
+    }
+    return *this;
+}
+
+void LoadingTask::onProgress(ProgressCallback callback) {
+    m_on_progress = std::move(callback);
+}
+
+auto LoadingTask::update(std::size_t max_uploads) -> bool {
+    const auto loaded = m_loaded;
+    const bool headless = Settings::getConfig().headless;
+
+    // fonts are ready to use once loaded, nothing to do on this thread
+    m_pending_fonts.erase(std::remove_if(m_pending_fonts.begin(), m_pending_fonts.end(), [&](std::size_t i) {
+        if (!isReady(m_fonts[i].loaded))
+            return false;
+        m_failed += !m_fonts[i].loaded.get();
+        m_loaded++;
+        return true;
+    }), m_pending_fonts.end());
+
+    std::size_t uploads = 0;
+    m_pending_textures.erase(std::remove_if(m_pending_textures.begin(), m_pending_textures.end(), [&](std::size_t i) {
+        auto& entry = m_textures[i];
+        if (uploads >= max_uploads || !isReady(entry.decoded))
+            return false;
+        auto upload = entry.decoded.get();
+        if (!upload)
+            m_failed++;
+        else if (!headless) {
+            m_failed += !upload(*entry.texture);
+            uploads++;
+        }
+        m_loaded++;
+        return true;
+    }), m_pending_textures.end());
+
+    if (m_loaded != loaded)
+        notify();
+    return isDone();
+}
+
+void LoadingTask::wait() {
+    while (!update()) {
+        // wait for the next texture, and upload the ones decoded meanwhile
+        if (!m_pending_textures.empty())
+            m_textures[m_pending_textures.front()].decoded.wait();
+        else if (!m_pending_fonts.empty())
+            m_fonts[m_pending_fonts.front()].loaded.wait();
+    }
+}
+
+auto LoadingTask::isDone() const -> bool {
+    return m_pending_textures.empty() && m_pending_fonts.empty();
+}
+
+auto LoadingTask::getLoadedCount() const -> std::size_t {
+    return m_loaded;
+}
+
+auto LoadingTask::getTotalCount() const -> std::size_t {
+    return m_textures.size() + m_fonts.size();
+}
+
+auto LoadingTask::getProgress() const -> float {
+    const auto total = getTotalCount();
+    return total == 0 ? 1.f : static_cast<float>(m_loaded) / static_cast<float>(total);
+}
+
+auto LoadingTask::getFailedCount() const -> std::size_t {
+    return m_failed;
+}
+
+void LoadingTask::addTexture(sf::Texture& texture, std::function<bool(sf::Image&)> decode) {
+    auto& entry = m_textures.emplace_back();
+    entry.texture = &texture;
+    entry.decoded = ThreadPool::getDefault().enqueue([decode=std::move(decode)] {
+        auto image = std::make_shared<sf::Image>();
+        if (!decode(*image))
+            return Upload();
+        return Upload([image](sf::Texture& texture) { return texture.loadFromImage(*image); });
+    });
+    m_pending_textures.push_back(m_textures.size() - 1);
+}
+
+void LoadingTask::addRawTexture(sf::Texture& texture, std::function<bool(RawTexture&)> read) {
+    auto& entry = m_textures.emplace_back();
+    entry.texture = &texture;
+    entry.decoded = ThreadPool::getDefault().enqueue([read=std::move(read)] {
+        auto raw = std::make_shared<RawTexture>();
+        if (!read(*raw))
+            return Upload();
+        return Upload([raw](sf::Texture& texture) { return raw->upload(texture); });
+    });
+    m_pending_textures.push_back(m_textures.size() - 1);
+}
+
+void LoadingTask::addFont(std::function<bool()> load) {
+    auto& entry = m_fonts.emplace_back();
+    entry.loaded = ThreadPool::getDefault().enqueue(std::move(load));
+    m_pending_fonts.push_back(m_fonts.size() - 1);
+}
+
+void LoadingTask::join() {
+    // the workers write in the fonts, they must be done before they are released
+    for (auto i : m_pending_textures)
+        m_textures[i].decoded.wait();
+    for (auto i : m_pending_fonts)
+        m_fonts[i].loaded.wait();
+}
+
+void LoadingTask::notify() {
+    if (m_on_progress)
+        m_on_progress(m_loaded, getTotalCount());
+}
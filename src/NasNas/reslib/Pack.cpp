@@ -0,0 +1,472 @@
+#include <NasNas/reslib/Pack.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include <NasNas/reslib/RawTexture.hpp>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__ANDROID__)
+#include <SFML/System/FileInputStream.hpp>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifndef __ANDROID__
+#include <filesystem>
+#endif
+
+using namespace ns;
+
+namespace {
+    constexpr char Magic[4] = {'N', 'S', 'P', 'K'};
+    constexpr std::size_t HeaderSize = 16;
+    constexpr std::size_t EntryHeaderSize = 8 + 8 + 8 + 4 + 4;
+
+    template <typename T>
+    auto readLE(const char* data) -> T {
+        T value = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+            value |= static_cast<T>(static_cast<unsigned char>(data[i])) << (8*i);
+        return value;
+    }
+
+    template <typename T>
+    void writeLE(std::vector<char>& out, T value) {
+        for (std::size_t i = 0; i < sizeof(T); ++i)
+            out.push_back(static_cast<char>((value >> (8*i)) & 0xff));
+    }
+
+    // LZ77 sequences : a token (literals count on 4 bits, match length - 4 on 4 bits), the extra literals
+    // count, the literals, the match offset (u16), the extra match length. Counts of 15 are followed by
+    // bytes added to the count until a byte is not 255. The last sequence only has literals.
+    constexpr std::size_t MinMatch = 4;
+    constexpr std::size_t MaxOffset = 0xffff;
+
+    void writeLength(std::vector<char>& out, std::size_t length) {
+        for (; length >= 255; length -= 255)
+            out.push_back(static_cast<char>(255));
+        out.push_back(static_cast<char>(length));
+    }
+
+    void writeSequence(std::vector<char>& out, const char* literals, std::size_t literals_count, std::size_t offset, std::size_t match) {
+        const auto lit_token = std::min<std::size_t>(literals_count, 15);
+        const auto match_token = match == 0 ? 0 : std::min<std::size_t>(match - MinMatch, 15);
+        out.push_back(static_cast<char>((lit_token << 4) | match_token));
+        if (lit_token == 15)
+            writeLength(out, literals_count - 15);
+        out.insert(out.end(), literals, literals + literals_count);
+        if (match == 0)
+            return;
+        writeLE<std::uint16_t>(out, static_cast<std::uint16_t>(offset));
+        if (match_token == 15)
+            writeLength(out, match - MinMatch - 15);
+    }
+
+    auto compressLZ(const char* src, std::size_t size) -> std::vector<char> {
+        std::vector<char> out;
+        out.reserve(size / 2);
+        constexpr std::size_t HashBits = 14;
+        std::vector<std::size_t> table(std::size_t(1) << HashBits, SIZE_MAX);
+        auto hash = [&](std::size_t i) {
+            return (readLE<std::uint32_t>(src + i) * 2654435761u) >> (32 - HashBits);
+        };
+
+        std::size_t anchor = 0, i = 0;
+        while (i + MinMatch <= size) {
+            auto& candidate = table[hash(i)];
+            const auto match_pos = candidate;
+            candidate = i;
+            if (match_pos != SIZE_MAX && i - match_pos <= MaxOffset && std::memcmp(src + match_pos, src + i, MinMatch) == 0) {
+                auto length = MinMatch;
+                while (i + length < size && src[match_pos + length] == src[i + length])
+                    ++length;
+                writeSequence(out, src + anchor, i - anchor, i - match_pos, length);
+                i += length;
+                anchor = i;
+            }
+            else {
+                ++i;
+            }
+        }
+        writeSequence(out, src + anchor, size - anchor, 0, 0);
+        return out;
+    }
+
+    auto decompressLZ(const char* src, std::size_t src_size, char* dst, std::size_t dst_size) -> bool {
+        const char* ip = src;
+        const char* const ip_end = src + src_size;
+        std::size_t op = 0;
+        auto readLength = [&](std::size_t& length) {
+            unsigned char byte;
+            do {
+                if (ip == ip_end) return false;
+                byte = static_cast<unsigned char>(*ip++);
+                length += byte;
+            } while (byte == 255);
+            return true;
+        };
+
+        while (ip < ip_end) {
+            const auto token = static_cast<unsigned char>(*ip++);
+            std::size_t literals = token >> 4;
+            if (literals == 15 && !readLength(literals))
+                return false;
+            if (literals > std::size_t(ip_end - ip) || literals > dst_size - op)
+                return false;
+            std::memcpy(dst + op, ip, literals);
+            ip += literals;
+            op += literals;
+            if (ip == ip_end)
+                break;
+
+            if (ip_end - ip < 2)
+                return false;
+            const auto offset = readLE<std::uint16_t>(ip);
+            ip += 2;
+            std::size_t match = (token & 0x0f) + MinMatch;
+            if ((token & 0x0f) == 15 && !readLength(match))
+                return false;
+            if (offset == 0 || offset > op || match > dst_size - op)
+                return false;
+            // byte by byte, the match can overlap the bytes it produces
+            for (std::size_t k = 0; k < match; ++k, ++op)
+                dst[op] = dst[op - offset];
+        }
+        return op == dst_size;
+    }
+
+    auto isCompressedFormat(const std::string& path) -> bool {
+        auto extension = path.substr(std::min(path.find_last_of('.'), path.size()));
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+        return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".ogg";
+    }
+}
+
+Pack::Pack() = default;
+
+Pack::~Pack() {
+    close();
+}
+
+auto Pack::open(const std::string& filename) -> bool {
+    close();
+    if (!map(filename))
+        return false;
+    m_filename = filename;
+    if (!readIndex()) {
+        std::cerr << "Error (Pack) : " << filename << " is not a valid pack file." << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void Pack::close() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_decompressed.clear();
+    }
+    m_index.clear();
+    m_entries.clear();
+    unmap();
+    m_filename.clear();
+}
+
+auto Pack::isOpen() const -> bool {
+    return m_data != nullptr;
+}
+
+auto Pack::getFilename() const -> const std::string& {
+    return m_filename;
+}
+
+auto Pack::getEntries() const -> const std::vector<Entry>& {
+    return m_entries;
+}
+
+auto Pack::find(const std::string& path) const -> const Entry* {
+    auto it = m_index.find(path);
+    return it == m_index.end() ? nullptr : &m_entries[it->second];
+}
+
+auto Pack::getData(const Entry& entry) const -> Data {
+    const auto* stored = m_data + entry.offset;
+    if (entry.compression == Compression::None)
+        return {stored, static_cast<std::size_t>(entry.size)};
+
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_decompressed.find(&entry);
+        if (it != m_decompressed.end())
+            return {it->second.get(), static_cast<std::size_t>(entry.size)};
+    }
+    // decompressed without the lock, entries are decoded in parallel by the LoadingTask
+    auto decompressed = std::make_unique<char[]>(static_cast<std::size_t>(entry.size));
+    if (!decompressLZ(stored, entry.stored_size, decompressed.get(), entry.size)) {
+        std::cerr << "Error (Pack) : Could not decompress " << entry.path << " from " << m_filename << std::endl;
+        return {};
+    }
+    std::lock_guard lock(m_mutex);
+    auto& buffer = m_decompressed[&entry];
+    if (buffer == nullptr)
+        buffer = std::move(decompressed);
+    return {buffer.get(), static_cast<std::size_t>(entry.size)};
+}
+
+auto Pack::readData(const Entry& entry) const -> Buffer {
+    const auto* stored = m_data + entry.offset;
+    if (entry.compression == Compression::None)
+        return {{stored, static_cast<std::size_t>(entry.size)}, nullptr};
+
+    {
+        std::lock_guard lock(m_mutex);
+        auto it = m_decompressed.find(&entry);
+        if (it != m_decompressed.end())
+            return {{it->second.get(), static_cast<std::size_t>(entry.size)}, nullptr};
+    }
+    auto decompressed = std::make_unique<char[]>(static_cast<std::size_t>(entry.size));
+    if (!decompressLZ(stored, entry.stored_size, decompressed.get(), entry.size)) {
+        std::cerr << "Error (Pack) : Could not decompress " << entry.path << " from " << m_filename << std::endl;
+        return {};
+    }
+    const Data data = {decompressed.get(), static_cast<std::size_t>(entry.size)};
+    return {data, std::move(decompressed)};
+}
+
+auto Pack::readIndex() -> bool {
+    if (m_size < HeaderSize || std::memcmp(m_data, Magic, sizeof(Magic)) != 0)
+        return false;
+    if (readLE<std::uint32_t>(m_data + 4) != Version)
+        return false;
+    const auto count = readLE<std::uint32_t>(m_data + 8);
+    const auto index_size = readLE<std::uint32_t>(m_data + 12);
+    if (index_size > m_size - HeaderSize)
+        return false;
+
+    const char* it = m_data + HeaderSize;
+    const char* const end = it + index_size;
+    m_entries.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (std::size_t(end - it) < EntryHeaderSize)
+            return false;
+        auto& entry = m_entries.emplace_back();
+        entry.offset = readLE<std::uint64_t>(it);
+        entry.size = readLE<std::uint64_t>(it + 8);
+        entry.stored_size = readLE<std::uint64_t>(it + 16);
+        entry.compression = static_cast<Compression>(readLE<std::uint32_t>(it + 24));
+        const auto path_size = readLE<std::uint32_t>(it + 28);
+        it += EntryHeaderSize;
+        if (std::size_t(end - it) < path_size)
+            return false;
+        entry.path.assign(it, path_size);
+        it += path_size;
+
+        if (entry.offset > m_size || entry.stored_size > m_size - entry.offset)
+            return false;
+        if (entry.compression == Compression::None && entry.size != entry.stored_size)
+            return false;
+        if (entry.compression != Compression::None && entry.compression != Compression::LZ)
+            return false;
+        m_index[entry.path] = i;
+    }
+    return true;
+}
+
+#if defined(_WIN32)
+
+auto Pack::map(const std::string& filename) -> bool {
+    auto file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return false;
+    auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        return false;
+    }
+    m_mapping = mapping;
+    m_data = static_cast<const char*>(view);
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    return true;
+}
+
+void Pack::unmap() {
+    if (m_mapping != nullptr) {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mapping);
+        m_mapping = nullptr;
+    }
+    m_buffer.reset();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#elif defined(__ANDROID__)
+
+// files in the apk can not be mapped, the pack is read in memory once
+auto Pack::map(const std::string& filename) -> bool {
+    sf::FileInputStream stream;
+    if (!stream.open(filename))
+        return false;
+    const auto size = stream.getSize();
+    if (size <= 0)
+        return false;
+    m_buffer = std::make_unique<char[]>(static_cast<std::size_t>(size));
+    if (stream.read(m_buffer.get(), size) != size) {
+        m_buffer.reset();
+        return false;
+    }
+    m_data = m_buffer.get();
+    m_size = static_cast<std::size_t>(size);
+    return true;
+}
+
+void Pack::unmap() {
+    m_buffer.reset();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#else
+
+auto Pack::map(const std::string& filename) -> bool {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat status{};
+    if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    const auto size = static_cast<std::size_t>(status.st_size);
+    auto* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+        return false;
+    m_mapping = view;
+    m_data = static_cast<const char*>(view);
+    m_size = size;
+    return true;
+}
+
+void Pack::unmap() {
+    if (m_mapping != nullptr) {
+        munmap(m_mapping, m_size);
+        m_mapping = nullptr;
+    }
+    m_buffer.reset();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+#endif
+
+auto Pack::build(const std::string& directory, const std::string& filename, bool compress) -> bool {
+#ifndef __ANDROID__
+    namespace fs = std::filesystem;
+    if (!fs::is_directory(directory)) {
+        std::cerr << "Error (Pack) : " << directory << " is not a directory." << std::endl;
+        return false;
+    }
+
+    // sorted paths, the same directory always gives the same pack
+    std::vector<std::string> paths;
+    for (const auto& file : fs::recursive_directory_iterator(directory)) {
+        if (file.is_regular_file())
+            paths.push_back(fs::relative(file.path(), directory).generic_string());
+    }
+    std::sort(paths.begin(), paths.end());
+    // the images converted to raw textures are loaded from the raw textures, they are not packed
+    const auto files = paths;
+    paths.erase(std::remove_if(paths.begin(), paths.end(), [&](const std::string& path) {
+        return std::binary_search(files.begin(), files.end(), path + RawTexture::Extension);
+    }), paths.end());
+
+    std::vector<Entry> entries;
+    std::vector<std::vector<char>> contents;
+    for (const auto& path : paths) {
+        std::ifstream file(fs::path(directory) / path, std::ios::binary);
+        std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (!file.good() && !file.eof()) {
+            std::cerr << "Error (Pack) : Could not read " << path << std::endl;
+            return false;
+        }
+        auto& entry = entries.emplace_back();
+        entry.path = path;
+        entry.size = content.size();
+        if (compress && !content.empty() && !isCompressedFormat(path)) {
+            auto compressed = compressLZ(content.data(), content.size());
+            // not worth decompressing for less than 10% saved
+            if (compressed.size() * 10 < content.size() * 9) {
+                entry.compression = Compression::LZ;
+                content = std::move(compressed);
+            }
+        }
+        entry.stored_size = content.size();
+        contents.push_back(std::move(content));
+    }
+
+    std::size_t index_size = 0;
+    for (const auto& entry : entries)
+        index_size += EntryHeaderSize + entry.path.size();
+    auto align = [](std::size_t offset) { return (offset + Alignment - 1) / Alignment * Alignment; };
+    auto offset = align(HeaderSize + index_size);
+    std::vector<char> index;
+    index.reserve(index_size);
+    for (auto& entry : entries) {
+        entry.offset = offset;
+        offset = align(offset + entry.stored_size);
+        writeLE<std::uint64_t>(index, entry.offset);
+        writeLE<std::uint64_t>(index, entry.size);
+        writeLE<std::uint64_t>(index, entry.stored_size);
+        writeLE<std::uint32_t>(index, static_cast<std::uint32_t>(entry.compression));
+        writeLE<std::uint32_t>(index, static_cast<std::uint32_t>(entry.path.size()));
+        index.insert(index.end(), entry.path.begin(), entry.path.end());
+    }
+
+    std::vector<char> header(Magic, Magic + sizeof(Magic));
+    writeLE<std::uint32_t>(header, Version);
+    writeLE<std::uint32_t>(header, static_cast<std::uint32_t>(entries.size()));
+    writeLE<std::uint32_t>(header, static_cast<std::uint32_t>(index.size()));
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Error (Pack) : Could not write " << filename << std::endl;
+        return false;
+    }
+    out.write(header.data(), header.size());
+    out.write(index.data(), index.size());
+    std::size_t written = HeaderSize + index.size();
+    const char padding[Alignment] = {};
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        out.write(padding, entries[i].offset - written);
+        out.write(contents[i].data(), contents[i].size());
+        written = entries[i].offset + contents[i].size();
+    }
+    return out.good();
+#else
+    std::cerr << "Error (Pack) : Packs can not be built on Android." << std::endl;
+    return false;
+#endif
+}
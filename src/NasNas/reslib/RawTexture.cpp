@@ -0,0 +1,127 @@
+#include <NasNas/reslib/RawTexture.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include <SFML/System/FileInputStream.hpp>
+
+using namespace ns;
+
+namespace {
+    constexpr char Magic[4] = {'N', 'S', 'T', 'X'};
+
+    auto readLE(const std::uint8_t* data) -> std::uint32_t {
+        return std::uint32_t(data[0]) | std::uint32_t(data[1]) << 8 | std::uint32_t(data[2]) << 16 | std::uint32_t(data[3]) << 24;
+    }
+
+    void writeLE(std::uint8_t* data, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i)
+            data[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+auto RawTexture::loadFromFile(const std::string& filename) -> bool {
+    // sf::FileInputStream also reads Android assets
+    sf::FileInputStream stream;
+    if (!stream.open(filename)) {
+        std::cerr << "Error (RawTexture) : Could not open " << filename << std::endl;
+        return false;
+    }
+    const auto size = stream.getSize();
+    if (size < 0)
+        return false;
+    std::vector<std::uint8_t> buffer(static_cast<std::size_t>(size));
+    if (stream.read(buffer.data(), size) != size)
+        return false;
+    if (!loadFromMemory(buffer.data(), buffer.size())) {
+        std::cerr << "Error (RawTexture) : " << filename << " is not a valid raw texture." << std::endl;
+        return false;
+    }
+    // the pixels point in the buffer, moving the vector keeps its data
+    m_buffer = std::move(buffer);
+    return true;
+}
+
+auto RawTexture::loadFromMemory(const void* data, std::size_t size) -> bool {
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    m_buffer.clear();
+    m_storage.reset();
+    m_pixels = nullptr;
+    m_size = {0, 0};
+    m_flags = None;
+    if (bytes == nullptr || size < HeaderSize || std::memcmp(bytes, Magic, sizeof(Magic)) != 0)
+        return false;
+    if (readLE(bytes + 4) != Version)
+        return false;
+    const auto width = readLE(bytes + 8);
+    const auto height = readLE(bytes + 12);
+    if (std::uint64_t(width) * height * 4 != size - HeaderSize)
+        return false;
+    m_size = {width, height};
+    m_flags = readLE(bytes + 16);
+    m_pixels = bytes + HeaderSize;
+    return true;
+}
+
+auto RawTexture::loadFromMemory(std::unique_ptr<char[]> data, std::size_t size) -> bool {
+    if (!loadFromMemory(static_cast<const void*>(data.get()), size))
+        return false;
+    m_storage = std::move(data);
+    return true;
+}
+
+auto RawTexture::getSize() const -> sf::Vector2u {
+    return m_size;
+}
+
+auto RawTexture::getFlags() const -> std::uint32_t {
+    return m_flags;
+}
+
+auto RawTexture::getPixels() const -> const std::uint8_t* {
+    return m_pixels;
+}
+
+auto RawTexture::upload(sf::Texture& texture) const -> bool {
+    if (m_pixels == nullptr || !texture.create(m_size.x, m_size.y))
+        return false;
+    texture.update(m_pixels);
+    texture.setSmooth((m_flags & Smooth) != 0);
+    if (m_flags & Mipmap)
+        texture.generateMipmap();
+    return true;
+}
+
+auto RawTexture::convert(const sf::Image& image, const std::string& filename, std::uint32_t flags) -> bool {
+    const auto size = image.getSize();
+    std::uint8_t header[HeaderSize] = {};
+    std::memcpy(header, Magic, sizeof(Magic));
+    writeLE(header + 4, Version);
+    writeLE(header + 8, size.x);
+    writeLE(header + 12, size.y);
+    writeLE(header + 16, flags);
+
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header), HeaderSize);
+    if (size.x > 0 && size.y > 0)
+        file.write(reinterpret_cast<const char*>(image.getPixelsPtr()), std::streamsize(size.x) * size.y * 4);
+    if (!file) {
+        std::cerr << "Error (RawTexture) : Could not write " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+auto RawTexture::getTextureName(const std::string& file_name) -> std::string {
+    const auto extension_size = std::strlen(Extension);
+    if (file_name.size() <= extension_size || file_name.compare(file_name.size() - extension_size, extension_size, Extension) != 0)
+        return file_name;
+    auto name = file_name.substr(0, file_name.size() - extension_size);
+    const auto dot = name.find_last_of('.');
+    const auto separator = name.find_last_of("/\\");
+    // "image.png.nstex" is loaded as "image.png", "image.nstex" keeps its name
+    if (dot == std::string::npos || (separator != std::string::npos && dot < separator) || dot + 1 == name.size())
+        return file_name;
+    return name;
+}
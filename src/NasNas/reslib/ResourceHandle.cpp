@@ -0,0 +1,83 @@
+#include <NasNas/reslib/ResourceHandle.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <NasNas/reslib/ResourceManager.hpp>
+
+using namespace ns;
+
+template <typename T>
+ResourceHandle<T>::ResourceHandle(ResourceId id) : m_id(id) {
+    ResourceManager::retain(m_id);
+}
+
+template <typename T>
+ResourceHandle<T>::ResourceHandle(const ResourceHandle& other) : m_id(other.m_id) {
+    ResourceManager::retain(m_id);
+}
+
+template <typename T>
+ResourceHandle<T>::ResourceHandle(ResourceHandle&& other) noexcept : m_id(std::exchange(other.m_id, ResourceId()))
+{}
+
+template <typename T>
+ResourceHandle<T>& ResourceHandle<T>::operator=(const ResourceHandle& other) {
+    if (this != &other) {
+        ResourceManager::retain(other.m_id);
+        reset();
+        m_id = other.m_id;
+    }
+    return *this;
+}
+
+template <typename T>
+ResourceHandle<T>& ResourceHandle<T>::operator=(ResourceHandle&& other) noexcept {
+    if (this != &other) {
+        reset();
+        m_id = std::exchange(other.m_id, ResourceId());
+    }
+    return *this;
+}
+
+template <typename T>
+ResourceHandle<T>::~ResourceHandle() {
+    reset();
+}
+
+template <typename T>
+auto ResourceHandle<T>::get() const -> T& {
+    if constexpr (std::is_same_v<T, sf::Texture>)
+        return ResourceManager::getTexture(m_id);
+    else
+        return ResourceManager::getFont(m_id);
+}
+
+template <typename T>
+auto ResourceHandle<T>::operator*() const -> T& {
+    return get();
+}
+
+template <typename T>
+auto ResourceHandle<T>::operator->() const -> T* {
+    return &get();
+}
+
+template <typename T>
+auto ResourceHandle<T>::getId() const -> ResourceId {
+    return m_id;
+}
+
+template <typename T>
+auto ResourceHandle<T>::isValid() const -> bool {
+    return m_id.isValid();
+}
+
+template <typename T>
+void ResourceHandle<T>::reset() {
+    ResourceManager::release(m_id);
+    m_id = ResourceId();
+}
+
+template class ns::ResourceHandle<sf::Texture>;
+template class ns::ResourceHandle<sf::Font>;
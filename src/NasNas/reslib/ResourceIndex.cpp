@@ -0,0 +1,91 @@
+#include <NasNas/reslib/ResourceIndex.hpp>
+
+#include <algorithm>
+
+using namespace ns;
+
+ResourceId::ResourceId(std::uint32_t index, std::uint32_t generation) :
+m_index(index),
+m_generation(generation)
+{}
+
+auto ResourceId::isValid() const -> bool {
+    return m_index != Invalid;
+}
+
+auto ResourceId::operator==(const ResourceId& other) const -> bool {
+    return m_index == other.m_index && m_generation == other.m_generation;
+}
+
+auto ResourceId::operator!=(const ResourceId& other) const -> bool {
+    return !(*this == other);
+}
+
+auto ResourceIndex::Slot::getName() const -> std::string {
+    return path.substr(path.find_last_of('/') + 1);
+}
+
+void ResourceIndex::clear() {
+    m_slots.clear();
+    m_hashes.clear();
+    m_buckets.clear();
+}
+
+auto ResourceIndex::add(Slot slot) -> std::uint32_t {
+    // keeps the load factor under 1/2
+    if ((m_slots.size() + 1) * 2 > m_buckets.size())
+        rehash(std::max<std::size_t>(16, m_buckets.size() * 2));
+
+    const auto index = static_cast<std::uint32_t>(m_slots.size());
+    const auto h = hash(slot.path);
+    const auto mask = m_buckets.size() - 1;
+    auto bucket = h & mask;
+    while (m_buckets[bucket] != NotFound)
+        bucket = (bucket + 1) & mask;
+    m_buckets[bucket] = index;
+    m_hashes.push_back(h);
+    m_slots.push_back(std::move(slot));
+    return index;
+}
+
+auto ResourceIndex::find(std::string_view path) const -> std::uint32_t {
+    if (m_buckets.empty())
+        return NotFound;
+    const auto h = hash(path);
+    const auto mask = m_buckets.size() - 1;
+    for (auto bucket = h & mask; m_buckets[bucket] != NotFound; bucket = (bucket + 1) & mask) {
+        const auto index = m_buckets[bucket];
+        if (m_hashes[index] == h && m_slots[index].path == path)
+            return index;
+    }
+    return NotFound;
+}
+
+auto ResourceIndex::get(std::uint32_t index) -> Slot& {
+    return m_slots[index];
+}
+
+auto ResourceIndex::size() const -> std::size_t {
+    return m_slots.size();
+}
+
+auto ResourceIndex::hash(std::string_view path) -> std::uint64_t {
+    // FNV-1a
+    std::uint64_t h = 14695981039346656037ull;
+    for (auto c : path) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+void ResourceIndex::rehash(std::size_t buckets_count) {
+    m_buckets.assign(buckets_count, NotFound);
+    const auto mask = buckets_count - 1;
+    for (std::uint32_t index = 0; index < m_slots.size(); ++index) {
+        auto bucket = m_hashes[index] & mask;
+        while (m_buckets[bucket] != NotFound)
+            bucket = (bucket + 1) & mask;
+        m_buckets[bucket] = index;
+    }
+}
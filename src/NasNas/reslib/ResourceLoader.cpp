@@ -5,28 +5,153 @@
 #include <NasNas/reslib/ResourceLoader.hpp>
 
 #include <iostream>
+
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/Utils.hpp>
 #ifndef __ANDROID__
 #include <filesystem>
 #else
 #include <NasNas/core/android/Activity.hpp>
-#include <NasNas/core/data/Utils.hpp>
 #include "../core/android/JniManager.hpp"
 #include "../core/android/JavaClasses.hpp"
 #endif
 
 using namespace ns;
 
-const std::set<std::string> Dir::texture_extensions = {".png", ".jpg", ".bmp"};
+namespace {
+    // headless apps have no OpenGL context, their textures are left empty
+    void loadTexture(sf::Texture& texture, const std::string& path, bool raw) {
+        if (Settings::getConfig().headless)
+            return;
+        RawTexture raw_texture;
+        if (!raw)
+            texture.loadFromFile(path);
+        else if (raw_texture.loadFromFile(path))
+            raw_texture.upload(texture);
+    }
+
+    void loadTexture(sf::Texture& texture, const Pack& pack, const Pack::Entry& entry, bool raw) {
+        if (Settings::getConfig().headless)
+            return;
+        auto buffer = pack.readData(entry);
+        RawTexture raw_texture;
+        if (!raw)
+            texture.loadFromMemory(buffer.data.data, buffer.data.size);
+        else if (raw_texture.loadFromMemory(buffer.data.data, buffer.data.size))
+            raw_texture.upload(texture);
+    }
+
+    // the font reads its data until it is destroyed, the pack keeps it in memory while it is open
+    auto loadFont(sf::Font& font, const Pack& pack, const Pack::Entry& entry) -> bool {
+        auto data = pack.getData(entry);
+        return data.data != nullptr && font.loadFromMemory(data.data, data.size);
+    }
+}
+
+const std::set<std::string> Dir::texture_extensions = {".png", ".jpg", ".bmp", RawTexture::Extension};
 const std::set<std::string> Dir::fonts_extensions = {".ttf"};
 
-Dir::Dir(std::string name, Dir* parent) :
+Dir::Dir(std::string name, Dir* parent, const Pack* pack) :
 m_name(std::move(name)),
-m_parent(parent)
+m_parent(parent),
+m_pack(pack != nullptr || parent == nullptr ? pack : parent->m_pack)
 {}
 
 Dir::~Dir() = default;
 
 void Dir::load(const std::string& path, bool autoload) {
+    if (m_pack != nullptr) {
+        for (const auto& entry : m_pack->getEntries())
+            addPacked(entry.path, entry);
+    }
+    else {
+        scan(path);
+    }
+    if (autoload) {
+        LoadingTask task;
+        loadAll(task);
+        task.wait();
+    }
+}
+
+void Dir::loadAll(LoadingTask& task) {
+    for (auto& [texture_name, ptr] : m_textures) {
+        if (ptr == nullptr) {
+            ptr = takeTexture(texture_name);
+            auto packed = m_packed.find(texture_name);
+            auto raw = m_raw_files.find(texture_name);
+            if (packed != m_packed.end() && raw != m_raw_files.end())
+                task.addRawTexture(*ptr, [pack=m_pack, entry=packed->second](RawTexture& raw_texture) {
+                    // the decompressed pixels are freed with the raw texture, after the upload
+                    auto buffer = pack->readData(*entry);
+                    if (buffer.storage != nullptr)
+                        return raw_texture.loadFromMemory(std::move(buffer.storage), buffer.data.size);
+                    return raw_texture.loadFromMemory(buffer.data.data, buffer.data.size);
+                });
+            else if (packed != m_packed.end())
+                task.addTexture(*ptr, [pack=m_pack, entry=packed->second](sf::Image& image) {
+                    auto buffer = pack->readData(*entry);
+                    return buffer.data.data != nullptr && image.loadFromMemory(buffer.data.data, buffer.data.size);
+                });
+            else if (raw != m_raw_files.end())
+                task.addRawTexture(*ptr, [path=getPath()+"/"+raw->second](RawTexture& raw_texture) {
+                    return raw_texture.loadFromFile(path);
+                });
+            else
+                task.addTexture(*ptr, [path=getPath()+"/"+texture_name](sf::Image& image) {
+                    return image.loadFromFile(path);
+                });
+        }
+    }
+    for (auto& [font_name, ptr] : m_fonts) {
+        if (ptr == nullptr) {
+            ptr = takeFont(font_name);
+            if (auto packed = m_packed.find(font_name); packed != m_packed.end())
+                task.addFont([&font=*ptr, pack=m_pack, entry=packed->second] { return loadFont(font, *pack, *entry); });
+            else
+                task.addFont([&font=*ptr, path=getPath()+"/"+font_name] { return font.loadFromFile(path); });
+        }
+    }
+    for (auto& [dir_name, dir] : m_dirs)
+        dir->loadAll(task);
+}
+
+void Dir::addPacked(const std::string& path, const Pack::Entry& entry) {
+    auto separator = path.find('/');
+    if (separator != std::string::npos) {
+        auto dir_name = path.substr(0, separator);
+        auto& dir = m_dirs[dir_name];
+        if (dir == nullptr)
+            dir = std::make_unique<Dir>(dir_name, this);
+        dir->addPacked(path.substr(separator+1), entry);
+        return;
+    }
+    auto extension = ns::utils::path::getExtension(path);
+    if (Dir::texture_extensions.count(extension) != 0) {
+        addTextureFile(path, &entry);
+    }
+    else if (Dir::fonts_extensions.count(extension) != 0) {
+        m_fonts.emplace(path, nullptr);
+        m_packed[path] = &entry;
+    }
+}
+
+void Dir::addTextureFile(const std::string& file_name, const Pack::Entry* entry) {
+    if (ns::utils::path::getExtension(file_name) == RawTexture::Extension) {
+        // a raw texture converted from an image replaces the image, under the name of the image
+        auto texture_name = RawTexture::getTextureName(file_name);
+        m_textures.emplace(texture_name, nullptr);
+        m_raw_files[texture_name] = file_name;
+        if (entry != nullptr)
+            m_packed[texture_name] = entry;
+        return;
+    }
+    m_textures.emplace(file_name, nullptr);
+    if (entry != nullptr && m_raw_files.count(file_name) == 0)
+        m_packed[file_name] = entry;
+}
+
+void Dir::scan(const std::string& path) {
 #ifndef __ANDROID__
     namespace fs = std::filesystem;
     if (fs::is_directory(fs::status(path))) {
@@ -35,27 +160,17 @@ void Dir::load(const std::string& path, bool autoload) {
             if (fs::is_regular_file(file)) {
                 if (file.path().has_extension()) {
                     if (Dir::texture_extensions.count(file.path().extension().string()) != 0) {
-                        m_textures.emplace(filename, nullptr);
-                        if (autoload) {
-                            std::unique_ptr<sf::Texture> new_texture(new sf::Texture());
-                            new_texture->loadFromFile(file.path().string());
-                            m_textures[filename] = std::move(new_texture);
-                        }
+                        addTextureFile(filename, nullptr);
                     }
                     else if (Dir::fonts_extensions.count(file.path().extension().string()) != 0) {
                         m_fonts.emplace(filename, nullptr);
-                        if (autoload) {
-                            std::unique_ptr<sf::Font> new_font(new sf::Font());
-                            new_font->loadFromFile(file.path().string());
-                            m_fonts[filename] = std::move(new_font);
-                        }
                     }
                 }
             }
             else if (fs::is_directory(file)) {
                 std::unique_ptr<Dir> new_dir(new Dir(filename, this));
                 m_dirs[filename] = std::move(new_dir);
-                m_dirs[filename]->load(file.path().string(), autoload);
+                m_dirs[filename]->scan(file.path().string());
             }
         }
     }
@@ -77,23 +192,15 @@ void Dir::load(const std::string& path, bool autoload) {
         auto file_is_folder = JNI.env()->GetArrayLength(JNI.get<content::res::AssetManager>(object_asset_manager).list(jstring_file_path)) > 0;
         if (file_is_folder) {
             m_dirs[file_name] = std::make_unique<Dir>(file_name, this);
-            m_dirs[file_name]->load(file_path, autoload);
+            m_dirs[file_name]->scan(file_path);
         }
         else {
             auto extension = ns::utils::path::getExtension(file_name);
             if (Dir::texture_extensions.count(extension) != 0) {
-                m_textures.emplace(file_name, nullptr);
-                if (autoload) {
-                    m_textures[file_name] = std::make_unique<sf::Texture>();
-                    m_textures[file_name]->loadFromFile(file_path);
-                }
+                addTextureFile(file_name, nullptr);
             }
             else if (Dir::fonts_extensions.count(extension) != 0) {
                 m_fonts.emplace(file_name, nullptr);
-                if (autoload) {
-                    m_fonts[file_name] = std::make_unique<sf::Font>();
-                    m_fonts[file_name]->loadFromFile(file_path);
-                }
             }
         }
     }
@@ -134,8 +241,14 @@ auto Dir::getTexture(const std::string& texture_name) -> sf::Texture& {
     if (m_textures.find(texture_name) != m_textures.end()) {
         auto& ptr = m_textures.at(texture_name);
         if (ptr == nullptr) {
-            m_textures[texture_name] = std::make_unique<sf::Texture>();
-            m_textures.at(texture_name)->loadFromFile(getPath()+"/"+texture_name);
+            m_textures[texture_name] = takeTexture(texture_name);
+            auto raw = m_raw_files.find(texture_name);
+            if (auto packed = m_packed.find(texture_name); packed != m_packed.end())
+                loadTexture(*m_textures.at(texture_name), *m_pack, *packed->second, raw != m_raw_files.end());
+            else if (raw != m_raw_files.end())
+                loadTexture(*m_textures.at(texture_name), getPath()+"/"+raw->second, true);
+            else
+                loadTexture(*m_textures.at(texture_name), getPath()+"/"+texture_name, false);
         }
         return *m_textures.at(texture_name);
     }
@@ -148,8 +261,11 @@ auto Dir::getFont(const std::string& font_name) -> sf::Font& {
     if (m_fonts.find(font_name) != m_fonts.end()) {
         auto& ptr = m_fonts.at(font_name);
         if (ptr == nullptr) {
-            m_fonts[font_name] = std::make_unique<sf::Font>();
-            m_fonts.at(font_name)->loadFromFile(getPath()+"/"+font_name);
+            m_fonts[font_name] = takeFont(font_name);
+            if (auto packed = m_packed.find(font_name); packed != m_packed.end())
+                loadFont(*m_fonts.at(font_name), *m_pack, *packed->second);
+            else
+                m_fonts.at(font_name)->loadFromFile(getPath()+"/"+font_name);
         }
         return *m_fonts.at(font_name);
     }
@@ -158,6 +274,52 @@ auto Dir::getFont(const std::string& font_name) -> sf::Font& {
     std::exit(-1);
 }
 
+auto Dir::takeTexture(const std::string& texture_name) -> std::unique_ptr<sf::Texture> {
+    auto it = m_evicted_textures.find(texture_name);
+    if (it == m_evicted_textures.end())
+        return std::make_unique<sf::Texture>();
+    auto texture = std::move(it->second);
+    m_evicted_textures.erase(it);
+    return texture;
+}
+
+auto Dir::takeFont(const std::string& font_name) -> std::unique_ptr<sf::Font> {
+    auto it = m_evicted_fonts.find(font_name);
+    if (it == m_evicted_fonts.end())
+        return std::make_unique<sf::Font>();
+    auto font = std::move(it->second);
+    m_evicted_fonts.erase(it);
+    return font;
+}
+
+void Dir::evictTexture(const std::string& texture_name) {
+    auto& ptr = m_textures.at(texture_name);
+    if (ptr == nullptr)
+        return;
+    *ptr = sf::Texture();
+    m_evicted_textures[texture_name] = std::move(ptr);
+}
+
+void Dir::evictFont(const std::string& font_name) {
+    auto& ptr = m_fonts.at(font_name);
+    if (ptr == nullptr)
+        return;
+    *ptr = sf::Font();
+    m_evicted_fonts[font_name] = std::move(ptr);
+}
+
+auto Dir::getFileSize(const std::string& file_name) -> std::size_t {
+    if (auto packed = m_packed.find(file_name); packed != m_packed.end())
+        return static_cast<std::size_t>(packed->second->size);
+#ifndef __ANDROID__
+    std::error_code error;
+    auto size = std::filesystem::file_size(getPath()+"/"+file_name, error);
+    return error ? 0 : static_cast<std::size_t>(size);
+#else
+    return 0;
+#endif
+}
+
 void Dir::printTree(int indent) {
     auto print_indent = [](int n) { for (int i = 0; i < n; ++i) { std::cout << "|  "; } };
 
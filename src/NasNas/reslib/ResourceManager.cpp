@@ -5,7 +5,17 @@
 
 #include <NasNas/reslib/ResourceManager.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <memory>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/FileWatcher.hpp>
+#include <NasNas/core/data/Utils.hpp>
 #ifndef __ANDROID__
 #include <filesystem>
 #endif
@@ -17,6 +27,15 @@ ResourceManager::~ResourceManager() = default;
 
 bool ResourceManager::m_ready = false;
 Dir* ResourceManager::m_data = nullptr;
+Pack ResourceManager::m_pack;
+ResourceIndex ResourceManager::m_index;
+std::uint32_t ResourceManager::m_generation = 0;
+std::uint64_t ResourceManager::m_clock = 0;
+std::size_t ResourceManager::m_gpu_budget = std::numeric_limits<std::size_t>::max();
+std::size_t ResourceManager::m_cpu_budget = std::numeric_limits<std::size_t>::max();
+std::size_t ResourceManager::m_evictions = 0;
+std::size_t ResourceManager::m_watch = 0;
+std::string ResourceManager::m_watch_root;
 std::string ResourceManager::m_root_dir_name;
 
 auto ResourceManager::load(const std::string& assets_directory_name, bool autoload) -> bool {
@@ -24,14 +43,33 @@ auto ResourceManager::load(const std::string& assets_directory_name, bool autolo
         delete m_data;
         m_data = nullptr;
     }
+    m_index.clear();
+    m_generation++;
+    m_evictions = 0;
+    unwatch();
+    m_pack.close();
     try {
-        m_data = new Dir(assets_directory_name, nullptr);
-        m_root_dir_name = assets_directory_name;
+        if (openPack(assets_directory_name)) {
+            auto root_name = assets_directory_name;
+            if (utils::path::getExtension(root_name) == Pack::Extension)
+                root_name.erase(root_name.size() - std::strlen(Pack::Extension));
+            m_data = new Dir(root_name, nullptr, &m_pack);
+            m_root_dir_name = root_name;
+            m_data->load(m_pack.getFilename(), autoload);
+        }
+        else {
+            m_data = new Dir(assets_directory_name, nullptr);
+            m_root_dir_name = assets_directory_name;
 #ifndef __ANDROID__
-        m_data->load(std::filesystem::current_path().append(assets_directory_name).string(), autoload);
+            const auto path = std::filesystem::current_path().append(assets_directory_name).string();
+            m_data->load(path, autoload);
+            if (Settings::getConfig().hot_reload)
+                watch(path);
 #else
-        m_data->load(assets_directory_name, autoload);
+            m_data->load(assets_directory_name, autoload);
 #endif
+        }
+        buildIndex(*m_data, "");
         m_ready = true;
         return true;
     }
@@ -41,9 +79,38 @@ auto ResourceManager::load(const std::string& assets_directory_name, bool autolo
     }
 }
 
+auto ResourceManager::loadAsync(const std::string& assets_directory_name, LoadingTask::ProgressCallback callback) -> LoadingTask {
+    LoadingTask task;
+    task.onProgress(std::move(callback));
+    if (load(assets_directory_name, false))
+        m_data->loadAll(task);
+    return task;
+}
+
 void ResourceManager::dispose() {
     if(m_ready)
         delete(m_data);
+    m_data = nullptr;
+    m_ready = false;
+    m_index.clear();
+    m_generation++;
+    unwatch();
+    m_pack.close();
+}
+
+auto ResourceManager::openPack(const std::string& name) -> bool {
+#ifndef __ANDROID__
+    namespace fs = std::filesystem;
+    auto path = fs::current_path().append(name);
+    if (fs::is_directory(path))
+        return false;
+    if (!fs::is_regular_file(path))
+        path += Pack::Extension;
+    return fs::is_regular_file(path) && m_pack.open(path.string());
+#else
+    // checking if a directory exists in the apk is slow, packs are only loaded from their full name
+    return utils::path::getExtension(name) == Pack::Extension && m_pack.open(name);
+#endif
 }
 
 void ResourceManager::checkReady() {
@@ -63,16 +130,267 @@ auto ResourceManager::getName() -> const std::string & {
 
 auto ResourceManager::getTexture(const std::string& texture_path) -> sf::Texture& {
     checkReady();
+    auto index = findSlot(texture_path);
+    if (index != ResourceIndex::NotFound && m_index.get(index).type == ResourceIndex::Type::Texture)
+        return getTexture(ResourceId(index, m_generation));
+    // relative paths with ".." and missing files go through the directory tree
     auto [dir, path] = resolvePath(texture_path);
     return dir->getTexture(path);
 }
 
 auto ResourceManager::getFont(const std::string& font_path) -> sf::Font& {
     checkReady();
+    auto index = findSlot(font_path);
+    if (index != ResourceIndex::NotFound && m_index.get(index).type == ResourceIndex::Type::Font)
+        return getFont(ResourceId(index, m_generation));
     auto [dir, path] = resolvePath(font_path);
     return dir->getFont(path);
 }
 
+auto ResourceManager::getId(const std::string& path) -> ResourceId {
+    checkReady();
+    auto index = findSlot(path);
+    return index == ResourceIndex::NotFound ? ResourceId() : ResourceId(index, m_generation);
+}
+
+auto ResourceManager::getTexture(ResourceId id) -> sf::Texture& {
+    auto& slot = getSlot(id, ResourceIndex::Type::Texture);
+    if (*slot.texture == nullptr) {
+        auto& texture = slot.dir->getTexture(slot.getName());
+        enforceBudget(id.m_index);
+        return texture;
+    }
+    return **slot.texture;
+}
+
+auto ResourceManager::getFont(ResourceId id) -> sf::Font& {
+    auto& slot = getSlot(id, ResourceIndex::Type::Font);
+    if (*slot.font == nullptr) {
+        auto& font = slot.dir->getFont(slot.getName());
+        enforceBudget(id.m_index);
+        return font;
+    }
+    return **slot.font;
+}
+
+auto ResourceManager::acquireTexture(const std::string& texture_path) -> TextureHandle {
+    auto id = getId(texture_path);
+    if (!id.isValid())
+        getTexture(texture_path);   // reports the missing file
+    return acquireTexture(id);
+}
+
+auto ResourceManager::acquireTexture(ResourceId id) -> TextureHandle {
+    getTexture(id);
+    return TextureHandle(id);
+}
+
+auto ResourceManager::acquireFont(const std::string& font_path) -> FontHandle {
+    auto id = getId(font_path);
+    if (!id.isValid())
+        getFont(font_path);
+    return acquireFont(id);
+}
+
+auto ResourceManager::acquireFont(ResourceId id) -> FontHandle {
+    getFont(id);
+    return FontHandle(id);
+}
+
+void ResourceManager::setMemoryBudget(std::size_t gpu_bytes, std::size_t cpu_bytes) {
+    m_gpu_budget = gpu_bytes;
+    m_cpu_budget = cpu_bytes;
+    if (m_ready)
+        trim();
+}
+
+void ResourceManager::trim() {
+    checkReady();
+    enforceBudget(ResourceIndex::NotFound);
+}
+
+auto ResourceManager::getStats() -> Stats {
+    checkReady();
+    return countMemory();
+}
+
+void ResourceManager::retain(ResourceId id) {
+    if (id.isValid() && id.m_generation == m_generation)
+        m_index.get(id.m_index).refs++;
+}
+
+void ResourceManager::release(ResourceId id) {
+    // handles of a previous load have nothing to release
+    if (!id.isValid() || id.m_generation != m_generation)
+        return;
+    if (--m_index.get(id.m_index).refs == 0)
+        enforceBudget(ResourceIndex::NotFound);
+}
+
+auto ResourceManager::countMemory() -> Stats {
+    Stats stats;
+    for (std::uint32_t i = 0; i < m_index.size(); ++i) {
+        auto& slot = m_index.get(i);
+        if (slot.type == ResourceIndex::Type::Texture) {
+            slot.bytes = 0;
+            if (*slot.texture != nullptr) {
+                const auto size = (*slot.texture)->getSize();
+                slot.bytes = std::size_t(size.x) * size.y * 4;
+                stats.textures++;
+            }
+            stats.textures_bytes += slot.bytes;
+        }
+        else {
+            if (*slot.font == nullptr)
+                slot.bytes = 0;
+            else {
+                if (slot.bytes == 0)
+                    slot.bytes = slot.dir->getFileSize(slot.getName());
+                stats.fonts++;
+            }
+            stats.fonts_bytes += slot.bytes;
+        }
+    }
+    stats.evictions = m_evictions;
+    return stats;
+}
+
+void ResourceManager::enforceBudget(std::uint32_t keep) {
+    if (m_gpu_budget == std::numeric_limits<std::size_t>::max() && m_cpu_budget == std::numeric_limits<std::size_t>::max())
+        return;
+    const auto stats = countMemory();
+    evict(ResourceIndex::Type::Texture, stats.textures_bytes, m_gpu_budget, keep);
+    evict(ResourceIndex::Type::Font, stats.fonts_bytes, m_cpu_budget, keep);
+}
+
+void ResourceManager::evict(ResourceIndex::Type type, std::size_t used, std::size_t budget, std::uint32_t keep) {
+    if (used <= budget)
+        return;
+    std::vector<std::uint32_t> candidates;
+    for (std::uint32_t i = 0; i < m_index.size(); ++i) {
+        const auto& slot = m_index.get(i);
+        // textures are only counted once uploaded, but fonts loading in a LoadingTask already have a size :
+        // fonts are only evicted once accessed through the ResourceManager, after their loading
+        if (slot.type == type && i != keep && slot.refs == 0 && slot.bytes > 0
+            && (type == ResourceIndex::Type::Texture || slot.last_use > 0))
+            candidates.push_back(i);
+    }
+    std::sort(candidates.begin(), candidates.end(), [](std::uint32_t lhs, std::uint32_t rhs) {
+        return m_index.get(lhs).last_use < m_index.get(rhs).last_use;
+    });
+    for (auto i : candidates) {
+        if (used <= budget)
+            break;
+        auto& slot = m_index.get(i);
+        if (type == ResourceIndex::Type::Texture)
+            slot.dir->evictTexture(slot.getName());
+        else
+            slot.dir->evictFont(slot.getName());
+        used -= slot.bytes;
+        slot.bytes = 0;
+        m_evictions++;
+    }
+}
+
+void ResourceManager::watch(const std::string& path) {
+#ifndef __ANDROID__
+    m_watch_root = std::filesystem::path(path).lexically_normal().generic_string();
+#else
+    m_watch_root = path;
+#endif
+    if (!m_watch_root.empty() && m_watch_root.back() == '/')
+        m_watch_root.pop_back();
+    // decoded on a worker, uploaded in place on the main thread so the references stay valid
+    m_watch = FileWatcher::getDefault().watchAsync(path, [](const std::string& file) -> std::function<void()> {
+        const auto extension = utils::path::getExtension(file);
+        if (extension == RawTexture::Extension) {
+            auto raw_texture = std::make_shared<RawTexture>();
+            if (!raw_texture->loadFromFile(file))
+                return nullptr;
+            return [file, raw_texture] {
+                auto* slot = findWatchedSlot(RawTexture::getTextureName(file));
+                if (slot != nullptr && *slot->texture != nullptr && !Settings::getConfig().headless)
+                    raw_texture->upload(**slot->texture);
+            };
+        }
+        if (Dir::texture_extensions.count(extension) != 0) {
+            auto image = std::make_shared<sf::Image>();
+            if (!image->loadFromFile(file))
+                return nullptr;
+            return [file, image] {
+                auto* slot = findWatchedSlot(file);
+                // the texture is loaded from the raw texture converted from the image, reloaded when converted again
+                if (slot != nullptr && slot->dir->m_raw_files.count(slot->getName()) != 0)
+                    return;
+                if (slot != nullptr && *slot->texture != nullptr && !Settings::getConfig().headless)
+                    (*slot->texture)->loadFromImage(*image);
+            };
+        }
+        if (Dir::fonts_extensions.count(extension) != 0) {
+            auto font = std::make_shared<sf::Font>();
+            if (!font->loadFromFile(file))
+                return nullptr;
+            return [file, font] {
+                auto* slot = findWatchedSlot(file);
+                if (slot != nullptr && *slot->font != nullptr)
+                    **slot->font = *font;
+            };
+        }
+        return nullptr;
+    });
+}
+
+void ResourceManager::unwatch() {
+    if (m_watch != 0)
+        FileWatcher::getDefault().unwatch(m_watch);
+    m_watch = 0;
+    m_watch_root.clear();
+}
+
+auto ResourceManager::findWatchedSlot(const std::string& file) -> ResourceIndex::Slot* {
+    if (!m_ready || file.size() <= m_watch_root.size() + 1 || file.compare(0, m_watch_root.size(), m_watch_root) != 0)
+        return nullptr;
+    auto index = m_index.find(std::string_view(file).substr(m_watch_root.size() + 1));
+    if (index == ResourceIndex::NotFound)
+        return nullptr;
+    return &m_index.get(index);
+}
+
+void ResourceManager::buildIndex(Dir& dir, const std::string& prefix) {
+    for (auto& [name, texture] : dir.m_textures)
+        m_index.add({prefix + name, ResourceIndex::Type::Texture, &dir, &texture, nullptr});
+    for (auto& [name, font] : dir.m_fonts)
+        m_index.add({prefix + name, ResourceIndex::Type::Font, &dir, nullptr, &font});
+    for (auto& [name, sub_dir] : dir.m_dirs)
+        buildIndex(*sub_dir, prefix + name + "/");
+}
+
+auto ResourceManager::findSlot(std::string_view path) -> std::uint32_t {
+    // paths can start with the root directory name
+    if (path.size() > m_root_dir_name.size() && path[m_root_dir_name.size()] == '/'
+        && path.compare(0, m_root_dir_name.size(), m_root_dir_name) == 0) {
+        auto index = m_index.find(path.substr(m_root_dir_name.size() + 1));
+        if (index != ResourceIndex::NotFound)
+            return index;
+    }
+    return m_index.find(path);
+}
+
+auto ResourceManager::getSlot(ResourceId id, ResourceIndex::Type type) -> ResourceIndex::Slot& {
+    checkReady();
+    if (!id.isValid() || id.m_generation != m_generation || id.m_index >= m_index.size()) {
+        std::cerr << "Error : Invalid ResourceId. Ids are only valid until the ResourceManager is loaded again." << std::endl;
+        exit(-1);
+    }
+    auto& slot = m_index.get(id.m_index);
+    if (slot.type != type) {
+        std::cerr << "Error : Resource " << slot.path << " is not a " << (type == ResourceIndex::Type::Texture ? "texture." : "font.") << std::endl;
+        exit(-1);
+    }
+    slot.last_use = ++m_clock;
+    return slot;
+}
+
 auto ResourceManager::resolvePath(const std::string& p) -> std::pair<Dir*, std::string> {
     std::string path = p;
     auto first_slash_idx = p.find_first_of('/');
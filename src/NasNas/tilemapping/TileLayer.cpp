@@ -5,6 +5,7 @@
 
 #include <NasNas/tilemapping/TileLayer.hpp>
 
+#include <NasNas/core/data/Config.hpp>
 #include <NasNas/thirdparty/pugixml.hpp>
 #include <NasNas/tilemapping/TiledMap.hpp>
 
@@ -55,8 +56,9 @@ m_height(xml_node.attribute("height").as_int())
     }
     addTile(tile_counter, current_gid);
 
-    // create the render texture
-    m_render_texture.create(m_width*m_tiledmap->getTileSize().x, m_height*m_tiledmap->getTileSize().y);
+    // create the render texture, headless apps never render it
+    if (!Settings::getConfig().headless)
+        m_render_texture.create(m_width*m_tiledmap->getTileSize().x, m_height*m_tiledmap->getTileSize().y);
 }
 
 auto TileLayer::getTile(int x, int y) const -> const std::optional<Tile>& {
@@ -93,7 +95,7 @@ void TileLayer::setTile(int x, int y, std::uint32_t gid) {
     
     if (!tileset.data.getTileData(id).animframes.empty()) {
         m_animated_tiles_pos[gid].index = 0;
-        m_animated_tiles_pos[gid].clock.restart();
+        m_animated_tiles_pos[gid].clock.setGroup(m_time_group);
         m_animated_tiles_pos[gid].positions.emplace_back(x, y);
     }
 
@@ -113,7 +115,7 @@ void TileLayer::update() {
         const auto& anim_frames = tileset.data.getTileData(gid - tileset.firstgid).animframes;
 
         // go to next anim frame when elapsed time is more than frame duration
-        if (anim_info.clock.getElapsedTime().asMilliseconds() > anim_frames[anim_index].duration) {
+        if (anim_info.clock.getElapsedTime() * 1000.f > (float)anim_frames[anim_index].duration) {
             anim_info.clock.restart();
             anim_index = (anim_index+1) % anim_frames.size();
             auto next_id = anim_frames[anim_index].tileid;
@@ -129,6 +131,12 @@ void TileLayer::update() {
     }
 }
 
+void TileLayer::setTimeGroup(TimeSource::Group group) {
+    m_time_group = group;
+    for (auto& [gid, anim_info] : m_animated_tiles_pos)
+        anim_info.clock.setGroup(group);
+}
+
 void TileLayer::addTile(int tile_index, std::uint32_t gid) {
     if (gid == 0) {
         return;
@@ -6,6 +6,8 @@
 
 #include <iostream>
 
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/FileWatcher.hpp>
 #include <NasNas/core/data/Utils.hpp>
 #include <NasNas/thirdparty/pugixml.hpp>
 #include <NasNas/tilemapping/GroupLayer.hpp>
@@ -22,8 +24,11 @@ using namespace ns::tm;
 
 TiledMap::TiledMap() = default;
 
-auto TiledMap::loadFromFile(const std::string& file_name) -> bool {
-    pugi::xml_document xml;
+TiledMap::~TiledMap() {
+    unwatchFiles();
+}
+
+auto TiledMap::parseFile(const std::string& file_name, pugi::xml_document& xml) -> bool {
     pugi::xml_parse_result result;
 
 #ifndef __ANDROID__
@@ -37,12 +42,75 @@ auto TiledMap::loadFromFile(const std::string& file_name) -> bool {
         std::cout << "Error parsing TMX file «" << file_name << "» : " << result.description() << std::endl;
         return false;
     }
+    return true;
+}
+
+auto TiledMap::loadFromFile(const std::string& file_name) -> bool {
+    pugi::xml_document xml;
+    if (!parseFile(file_name, xml))
+        return false;
     m_file_name = ns::utils::path::getFilename(file_name);
     m_file_relative_path = ns::utils::path::getPath(file_name);
     load(xml);
+    if (Settings::getConfig().hot_reload)
+        watchFiles();
+    return true;
+}
+
+auto TiledMap::reload() -> bool {
+    if (m_file_name.empty())
+        return false;
+    pugi::xml_document xml;
+    if (!parseFile(m_file_relative_path + m_file_name, xml))
+        return false;
+    replace(xml);
     return true;
 }
 
+void TiledMap::replace(const pugi::xml_document& xml) {
+    // the load before the previous one is freed, its layers were replaced by the last onReload
+    auto previous = std::make_unique<PreviousLoad>();
+    previous->layers = std::move(static_cast<LayersContainer&>(*this));
+    previous->tilesets = std::move(m_tilesets);
+    previous->tilesets_data = std::move(m_tilesets_data);
+    m_previous_load = std::move(previous);
+    static_cast<LayersContainer&>(*this) = LayersContainer();
+    m_tilesets.clear();
+    m_tilesets_data.clear();
+
+    load(xml);
+    if (!m_watches.empty())
+        watchFiles();
+    if (m_on_reload)
+        m_on_reload();
+}
+
+void TiledMap::onReload(std::function<void()> callback) {
+    m_on_reload = std::move(callback);
+}
+
+void TiledMap::watchFiles() {
+    unwatchFiles();
+    auto& watcher = FileWatcher::getDefault();
+    // the TMX file is parsed on a worker, the map is rebuilt on the main thread (it loads the tilesets textures)
+    auto reload_async = [this, file_name=m_file_relative_path + m_file_name](const std::string&) -> std::function<void()> {
+        auto xml = std::make_shared<pugi::xml_document>();
+        if (!parseFile(file_name, *xml))
+            return nullptr;
+        return [this, xml] { replace(*xml); };
+    };
+    m_watches.push_back(watcher.watchAsync(m_file_relative_path + m_file_name, reload_async));
+    // the TsxTilesetsManager watched the TSX files first, they are already reloaded when the map reloads
+    for (const auto& tsx_file : m_tsx_files)
+        m_watches.push_back(watcher.watchAsync(tsx_file, reload_async));
+}
+
+void TiledMap::unwatchFiles() {
+    for (auto id : m_watches)
+        FileWatcher::getDefault().unwatch(id);
+    m_watches.clear();
+}
+
 auto TiledMap::loadFromString(const std::string& data) -> bool {
     pugi::xml_document xml;
     pugi::xml_parse_result result;
@@ -62,6 +130,7 @@ auto TiledMap::getTMXFilePath() const -> const std::string& {
 }
 
 void TiledMap::load(const pugi::xml_document& xml) {
+    m_tsx_files.clear();
     auto xmlnode_map = xml.child("map");
     m_gridsize.x = xmlnode_map.attribute("width").as_uint();
     m_gridsize.y = xmlnode_map.attribute("height").as_uint();
@@ -79,7 +148,9 @@ void TiledMap::load(const pugi::xml_document& xml) {
         unsigned int firstgid = xmlnode_tileset.attribute("firstgid").as_uint();
         // external tileset
         if (xmlnode_tileset.attribute("source")){
-            const auto& tsx_tileset = TsxTilesetsManager::get(m_file_relative_path + xmlnode_tileset.attribute("source").as_string());
+            const auto tsx_file = m_file_relative_path + xmlnode_tileset.attribute("source").as_string();
+            const auto& tsx_tileset = TsxTilesetsManager::get(tsx_file);
+            m_tsx_files.push_back(tsx_file);
             m_tilesets.emplace_back(tsx_tileset, firstgid);
         }
         // embedded tileset
@@ -4,6 +4,8 @@
 
 #include <NasNas/tilemapping/Tileset.hpp>
 
+#include <NasNas/core/data/Config.hpp>
+#include <NasNas/core/data/FileWatcher.hpp>
 #include <NasNas/core/data/Utils.hpp>
 #include <NasNas/thirdparty/pugixml.hpp>
 
@@ -114,24 +116,69 @@ firstgid(first_gid)
 
 
 auto TsxTilesetsManager::get(const std::string& tsx_file_name) -> const TilesetData& {
+    auto& manager = instance();
+    if (manager.m_shared_tilesets.count(tsx_file_name))
+        return *manager.m_shared_tilesets.at(tsx_file_name);
+
+    auto tileset = parse(tsx_file_name);
+    if (!tileset)
+        std::exit(-1);
+    // registered before the TiledMaps using this file, so it is reloaded before them
+    if (Settings::getConfig().hot_reload)
+        FileWatcher::getDefault().watchAsync(tsx_file_name, [tsx_file_name](const std::string&) -> std::function<void()> {
+            auto xml = std::make_shared<pugi::xml_document>();
+            if (!parseFile(tsx_file_name, *xml))
+                return nullptr;
+            // the TilesetData loads its texture, on the main thread
+            return [tsx_file_name, xml] { replace(tsx_file_name, *xml); };
+        });
+    return *manager.m_shared_tilesets.emplace(tsx_file_name, std::move(tileset)).first->second;
+}
+
+auto TsxTilesetsManager::reload(const std::string& tsx_file_name) -> bool {
+    if (instance().m_shared_tilesets.count(tsx_file_name) == 0)
+        return false;
+    pugi::xml_document xml;
+    if (!parseFile(tsx_file_name, xml))
+        return false;
+    replace(tsx_file_name, xml);
+    return true;
+}
+
+void TsxTilesetsManager::replace(const std::string& tsx_file_name, const pugi::xml_document& xml) {
+    auto& manager = instance();
+    auto it = manager.m_shared_tilesets.find(tsx_file_name);
+    if (it == manager.m_shared_tilesets.end())
+        return;
+    auto tileset = std::make_unique<TilesetData>(xml.child("tileset"), utils::path::getPath(tsx_file_name));
+    manager.m_reloaded_tilesets[tsx_file_name] = std::move(it->second);
+    it->second = std::move(tileset);
+}
+
+auto TsxTilesetsManager::instance() -> TsxTilesetsManager& {
     static TsxTilesetsManager instance;
-    if (instance.m_shared_tilesets.count(tsx_file_name))
-        return instance.m_shared_tilesets.at(tsx_file_name);
-    else {
-        pugi::xml_document xml;
-        pugi::xml_parse_result result;
+    return instance;
+}
+
+auto TsxTilesetsManager::parseFile(const std::string& tsx_file_name, pugi::xml_document& xml) -> bool {
+    pugi::xml_parse_result result;
 #ifndef __ANDROID__
-        result = xml.load_file(tsx_file_name.c_str());
+    result = xml.load_file(tsx_file_name.c_str());
 #else
-        auto* asset = AAssetManager_open(android::getActivity()->assetManager, tsx_file_name.c_str(), AASSET_MODE_BUFFER);
-        const auto* filecontent = static_cast<const char*>(AAsset_getBuffer(asset));
-        result = xml.load_string(filecontent);
+    auto* asset = AAssetManager_open(android::getActivity()->assetManager, tsx_file_name.c_str(), AASSET_MODE_BUFFER);
+    const auto* filecontent = static_cast<const char*>(AAsset_getBuffer(asset));
+    result = xml.load_string(filecontent);
 #endif
-        if (!result) {
-            std::cout << "Error parsing TSX file «" << tsx_file_name << "» : " << result.description() << std::endl;
-            std::exit(-1);
-        }
-        instance.m_shared_tilesets.emplace(tsx_file_name, TilesetData(xml.child("tileset"), utils::path::getPath(tsx_file_name)));
-        return instance.m_shared_tilesets.at(tsx_file_name);
+    if (!result) {
+        std::cout << "Error parsing TSX file «" << tsx_file_name << "» : " << result.description() << std::endl;
+        return false;
     }
+    return true;
+}
+
+auto TsxTilesetsManager::parse(const std::string& tsx_file_name) -> std::unique_ptr<TilesetData> {
+    pugi::xml_document xml;
+    if (!parseFile(tsx_file_name, xml))
+        return nullptr;
+    return std::make_unique<TilesetData>(xml.child("tileset"), utils::path::getPath(tsx_file_name));
 }
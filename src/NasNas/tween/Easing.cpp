@@ -117,3 +117,38 @@ auto ns::easing::elasticOut(float t) -> float {
 auto ns::easing::elasticInOut(float t) -> float {
     return custom::elasticInOut<25>(t);
 }
+
+auto ns::easing::evaluate(tween::EasingType type, float t) -> float {
+    using tween::EasingType;
+    switch (type) {
+        case EasingType::Linear: return linear(t);
+        case EasingType::QuadraticIn: return quadraticIn(t);
+        case EasingType::QuadraticOut: return quadraticOut(t);
+        case EasingType::QuadraticInOut: return quadraticInOut(t);
+        case EasingType::CubicIn: return cubicIn(t);
+        case EasingType::CubicOut: return cubicOut(t);
+        case EasingType::CubicInOut: return cubicInOut(t);
+        case EasingType::SinusoidalIn: return sinusoidalIn(t);
+        case EasingType::SinusoidalOut: return sinusoidalOut(t);
+        case EasingType::SinusoidalInOut: return sinusoidalInOut(t);
+        case EasingType::ExponentialIn: return exponentialIn(t);
+        case EasingType::ExponentialOut: return exponentialOut(t);
+        case EasingType::ExponentialInOut: return exponentialInOut(t);
+        case EasingType::CircularIn: return circularIn(t);
+        case EasingType::CircularOut: return circularOut(t);
+        case EasingType::CircularInOut: return circularInOut(t);
+        case EasingType::BounceIn: return bounceIn(t);
+        case EasingType::BounceOut: return bounceOut(t);
+        case EasingType::BounceInOut: return bounceInOut(t);
+        case EasingType::BackIn: return backIn(t);
+        case EasingType::BackOut: return backOut(t);
+        case EasingType::BackInOut: return backInOut(t);
+        case EasingType::BackIn2: return backIn2(t);
+        case EasingType::BackOut2: return backOut2(t);
+        case EasingType::BackInOut2: return backInOut2(t);
+        case EasingType::ElasticIn: return elasticIn(t);
+        case EasingType::ElasticOut: return elasticOut(t);
+        case EasingType::ElasticInOut: return elasticInOut(t);
+        default: return t;
+    }
+}
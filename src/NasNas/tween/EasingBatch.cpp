@@ -0,0 +1,318 @@
+#include <NasNas/tween/Easing.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NS_EASING_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NS_EASING_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define NS_EASING_NEON
+#endif
+
+namespace {
+namespace simd {
+
+#if defined(NS_EASING_AVX2)
+
+    struct Vec {
+        static constexpr std::size_t Width = 8;
+        __m256 v;
+        static auto load(const float* p) -> Vec { return {_mm256_loadu_ps(p)}; }
+        static auto set(float x) -> Vec { return {_mm256_set1_ps(x)}; }
+        void store(float* p) const { _mm256_storeu_ps(p, v); }
+    };
+    inline auto operator+(Vec a, Vec b) -> Vec { return {_mm256_add_ps(a.v, b.v)}; }
+    inline auto operator-(Vec a, Vec b) -> Vec { return {_mm256_sub_ps(a.v, b.v)}; }
+    inline auto operator*(Vec a, Vec b) -> Vec { return {_mm256_mul_ps(a.v, b.v)}; }
+    inline auto operator/(Vec a, Vec b) -> Vec { return {_mm256_div_ps(a.v, b.v)}; }
+    inline auto sqrt(Vec a) -> Vec { return {_mm256_sqrt_ps(a.v)}; }
+    inline auto min(Vec a, Vec b) -> Vec { return {_mm256_min_ps(a.v, b.v)}; }
+    inline auto max(Vec a, Vec b) -> Vec { return {_mm256_max_ps(a.v, b.v)}; }
+    inline auto less(Vec a, Vec b) -> Vec { return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)}; }
+    inline auto equal(Vec a, Vec b) -> Vec { return {_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)}; }
+    inline auto either(Vec mask_a, Vec mask_b) -> Vec { return {_mm256_or_ps(mask_a.v, mask_b.v)}; }
+    inline auto select(Vec mask, Vec a, Vec b) -> Vec { return {_mm256_blendv_ps(b.v, a.v, mask.v)}; }
+    inline auto round(Vec a) -> Vec { return {_mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+    inline auto scaleByPow2(Vec a, Vec k) -> Vec {
+        const auto exponent = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(k.v), _mm256_set1_epi32(127)), 23);
+        return {_mm256_mul_ps(a.v, _mm256_castsi256_ps(exponent))};
+    }
+    inline auto negateIfOdd(Vec a, Vec k) -> Vec {
+        return {_mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtps_epi32(k.v), 31)))};
+    }
+
+#elif defined(NS_EASING_SSE2)
+
+    struct Vec {
+        static constexpr std::size_t Width = 4;
+        __m128 v;
+        static auto load(const float* p) -> Vec { return {_mm_loadu_ps(p)}; }
+        static auto set(float x) -> Vec { return {_mm_set1_ps(x)}; }
+        void store(float* p) const { _mm_storeu_ps(p, v); }
+    };
+    inline auto operator+(Vec a, Vec b) -> Vec { return {_mm_add_ps(a.v, b.v)}; }
+    inline auto operator-(Vec a, Vec b) -> Vec { return {_mm_sub_ps(a.v, b.v)}; }
+    inline auto operator*(Vec a, Vec b) -> Vec { return {_mm_mul_ps(a.v, b.v)}; }
+    inline auto operator/(Vec a, Vec b) -> Vec { return {_mm_div_ps(a.v, b.v)}; }
+    inline auto sqrt(Vec a) -> Vec { return {_mm_sqrt_ps(a.v)}; }
+    inline auto min(Vec a, Vec b) -> Vec { return {_mm_min_ps(a.v, b.v)}; }
+    inline auto max(Vec a, Vec b) -> Vec { return {_mm_max_ps(a.v, b.v)}; }
+    inline auto less(Vec a, Vec b) -> Vec { return {_mm_cmplt_ps(a.v, b.v)}; }
+    inline auto equal(Vec a, Vec b) -> Vec { return {_mm_cmpeq_ps(a.v, b.v)}; }
+    inline auto either(Vec mask_a, Vec mask_b) -> Vec { return {_mm_or_ps(mask_a.v, mask_b.v)}; }
+    inline auto select(Vec mask, Vec a, Vec b) -> Vec { return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))}; }
+    // the default rounding mode of the conversion is to nearest
+    inline auto round(Vec a) -> Vec { return {_mm_cvtepi32_ps(_mm_cvtps_epi32(a.v))}; }
+    inline auto scaleByPow2(Vec a, Vec k) -> Vec {
+        const auto exponent = _mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(k.v), _mm_set1_epi32(127)), 23);
+        return {_mm_mul_ps(a.v, _mm_castsi128_ps(exponent))};
+    }
+    inline auto negateIfOdd(Vec a, Vec k) -> Vec {
+        return {_mm_xor_ps(a.v, _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtps_epi32(k.v), 31)))};
+    }
+
+#elif defined(NS_EASING_NEON)
+
+    struct Vec {
+        static constexpr std::size_t Width = 4;
+        float32x4_t v;
+        static auto load(const float* p) -> Vec { return {vld1q_f32(p)}; }
+        static auto set(float x) -> Vec { return {vdupq_n_f32(x)}; }
+        void store(float* p) const { vst1q_f32(p, v); }
+    };
+    inline auto operator+(Vec a, Vec b) -> Vec { return {vaddq_f32(a.v, b.v)}; }
+    inline auto operator-(Vec a, Vec b) -> Vec { return {vsubq_f32(a.v, b.v)}; }
+    inline auto operator*(Vec a, Vec b) -> Vec { return {vmulq_f32(a.v, b.v)}; }
+    inline auto operator/(Vec a, Vec b) -> Vec { return {vdivq_f32(a.v, b.v)}; }
+    inline auto sqrt(Vec a) -> Vec { return {vsqrtq_f32(a.v)}; }
+    inline auto min(Vec a, Vec b) -> Vec { return {vminq_f32(a.v, b.v)}; }
+    inline auto max(Vec a, Vec b) -> Vec { return {vmaxq_f32(a.v, b.v)}; }
+    inline auto less(Vec a, Vec b) -> Vec { return {vreinterpretq_f32_u32(vcltq_f32(a.v, b.v))}; }
+    inline auto equal(Vec a, Vec b) -> Vec { return {vreinterpretq_f32_u32(vceqq_f32(a.v, b.v))}; }
+    inline auto either(Vec mask_a, Vec mask_b) -> Vec {
+        return {vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(mask_a.v), vreinterpretq_u32_f32(mask_b.v)))};
+    }
+    inline auto select(Vec mask, Vec a, Vec b) -> Vec { return {vbslq_f32(vreinterpretq_u32_f32(mask.v), a.v, b.v)}; }
+    inline auto round(Vec a) -> Vec { return {vrndnq_f32(a.v)}; }
+    inline auto scaleByPow2(Vec a, Vec k) -> Vec {
+        const auto exponent = vshlq_n_s32(vaddq_s32(vcvtnq_s32_f32(k.v), vdupq_n_s32(127)), 23);
+        return {vmulq_f32(a.v, vreinterpretq_f32_s32(exponent))};
+    }
+    inline auto negateIfOdd(Vec a, Vec k) -> Vec {
+        const auto sign = vreinterpretq_u32_s32(vshlq_n_s32(vcvtnq_s32_f32(k.v), 31));
+        return {vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a.v), sign))};
+    }
+
+#endif
+
+#if defined(NS_EASING_AVX2) || defined(NS_EASING_SSE2) || defined(NS_EASING_NEON)
+#define NS_EASING_SIMD
+
+    inline auto operator-(Vec a) -> Vec { return Vec::set(0.f) - a; }
+    inline auto operator+(float a, Vec b) -> Vec { return Vec::set(a) + b; }
+    inline auto operator-(float a, Vec b) -> Vec { return Vec::set(a) - b; }
+    inline auto operator*(float a, Vec b) -> Vec { return Vec::set(a) * b; }
+    inline auto operator+(Vec a, float b) -> Vec { return a + Vec::set(b); }
+    inline auto operator-(Vec a, float b) -> Vec { return a - Vec::set(b); }
+    inline auto operator*(Vec a, float b) -> Vec { return a * Vec::set(b); }
+    inline auto less(Vec a, float b) -> Vec { return less(a, Vec::set(b)); }
+    inline auto equal(Vec a, float b) -> Vec { return equal(a, Vec::set(b)); }
+
+    /// 2^x, relative error below 3e-7 for x in [-126, 126] (x is clamped to this range)
+    inline auto exp2(Vec x) -> Vec {
+        x = min(max(x, Vec::set(-126.f)), Vec::set(126.f));
+        const auto k = round(x);
+        const auto f = x - k;
+        // Chebyshev fit of 2^f on [-0.5, 0.5]
+        auto p = Vec::set(1.340043216605409e-3f);
+        p = p * f + 9.676037097840151e-3f;
+        p = p * f + 5.550327214207524e-2f;
+        p = p * f + 2.402210735583116e-1f;
+        p = p * f + 6.931472067106197e-1f;
+        p = p * f + 1.0000000754953486f;
+        return scaleByPow2(p, k);
+    }
+
+    /// sin(pi * x), absolute error below 3e-7 for |x| < 2^22
+    inline auto sinPi(Vec x) -> Vec {
+        const auto k = round(x);
+        // u in [-1, 1], sin(pi * x) = (-1)^k * sin(pi/2 * u)
+        const auto u = (x - k) * 2.f;
+        const auto u2 = u * u;
+        // Chebyshev fit of sin(pi/2 * u) on [-1, 1], odd terms
+        auto p = Vec::set(1.5081716044392123e-4f);
+        p = p * u2 - 4.672220264893312e-3f;
+        p = p * u2 + 7.968847479744251e-2f;
+        p = p * u2 - 6.459633582709825e-1f;
+        p = p * u2 + 1.570796289902791f;
+        return negateIfOdd(p * u, k);
+    }
+
+    template <unsigned Degree>
+    inline auto power(Vec x) -> Vec {
+        auto result = x;
+        for (unsigned i = 1; i < Degree; ++i)
+            result = result * x;
+        return result;
+    }
+
+    //// Kernels, following the scalar functions of Easing.cpp and Easing.tpp ////////////////////
+
+    inline auto linear(Vec t) -> Vec { return t; }
+
+    template <unsigned Degree>
+    inline auto polynomialIn(Vec t) -> Vec { return power<Degree>(t); }
+    template <unsigned Degree>
+    inline auto polynomialOut(Vec t) -> Vec { return 1.f - power<Degree>(1.f - t); }
+    template <unsigned Degree>
+    inline auto polynomialInOut(Vec t) -> Vec {
+        const auto in = float(1u << (Degree - 1)) * power<Degree>(t);
+        const auto out = 1.f - power<Degree>(2.f - 2.f * t) * 0.5f;
+        return select(less(t, 0.5f), in, out);
+    }
+
+    inline auto sinusoidalIn(Vec t) -> Vec { return 1.f - sinPi(0.5f - 0.5f * t); }
+    inline auto sinusoidalOut(Vec t) -> Vec { return sinPi(0.5f * t); }
+    inline auto sinusoidalInOut(Vec t) -> Vec { return 0.5f - 0.5f * sinPi(0.5f - t); }
+
+    inline auto exponentialIn(Vec t) -> Vec { return select(equal(t, 0.f), Vec::set(0.f), exp2(10.f * t - 10.f)); }
+    inline auto exponentialOut(Vec t) -> Vec { return select(equal(t, 1.f), Vec::set(1.f), 1.f - exp2(-10.f * t)); }
+    inline auto exponentialInOut(Vec t) -> Vec {
+        const auto in = exp2(20.f * t - 10.f) * 0.5f;
+        const auto out = 1.f - exp2(10.f - 20.f * t) * 0.5f;
+        return select(either(equal(t, 0.f), equal(t, 1.f)), t, select(less(t, 0.5f), in, out));
+    }
+
+    inline auto circularIn(Vec t) -> Vec { return 1.f - sqrt(1.f - t * t); }
+    inline auto circularOut(Vec t) -> Vec { return sqrt(1.f - (1.f - t) * (1.f - t)); }
+    inline auto circularInOut(Vec t) -> Vec {
+        const auto in = 0.5f - sqrt(1.f - 4.f * t * t) * 0.5f;
+        const auto out = 0.5f + sqrt(1.f - (2.f - 2.f * t) * (2.f - 2.f * t)) * 0.5f;
+        return select(less(t, 0.5f), in, out);
+    }
+
+    inline auto bounceOut(Vec t) -> Vec {
+        constexpr float c = 9.5625f;
+        const auto t1 = t - 1.5f / 2.75f;
+        const auto t2 = t - 2.25f / 2.75f;
+        const auto t3 = t - 2.625f / 2.75f;
+        auto result = c * t3 * t3 + .984375f;
+        result = select(less(t, 2.5f / 2.75f), c * t2 * t2 + .9375f, result);
+        result = select(less(t, 2.f / 2.75f), (c - 1.f) * t1 * t1 + .75f, result);
+        return select(less(t, 1.f / 2.75f), (c - 2.f) * t * t, result);
+    }
+    inline auto bounceIn(Vec t) -> Vec { return 1.f - bounceOut(1.f - t); }
+    inline auto bounceInOut(Vec t) -> Vec {
+        return select(less(t, 0.5f), 0.5f - bounceOut(1.f - 2.f * t) * 0.5f, 0.5f + bounceOut(2.f * t - 1.f) * 0.5f);
+    }
+
+    inline auto backIn(Vec t) -> Vec {
+        constexpr float pull = 2.f;
+        return (pull + 1.f) * t * t * t - pull * t * t;
+    }
+    inline auto backOut(Vec t) -> Vec { return 1.f - backIn(1.f - t); }
+    inline auto backInOut(Vec t) -> Vec {
+        constexpr float pull = 1.525f * 2.f;
+        const auto s = t - 1.f;
+        const auto in = 2.f * t * t * (2.f * t * (pull + 1.f) - pull);
+        const auto out = 2.f * s * s * (2.f * (pull + 1.f) * s + pull) + 1.f;
+        return select(less(t, 0.5f), in, out);
+    }
+
+    inline auto backIn2(Vec t) -> Vec {
+        constexpr float pull = 2.f;
+        return pull * t * t - (pull - 1.f) * t;
+    }
+    inline auto backOut2(Vec t) -> Vec { return 1.f - backIn2(1.f - t); }
+    inline auto backInOut2(Vec t) -> Vec {
+        constexpr float pull = 2.f;
+        const auto s = t - 1.f;
+        const auto in = pull * (1.4142f * t) * (1.4142f * t) - (pull - 1.f) * t;
+        const auto out = 1.f - pull * (1.4142f * s) * (1.4142f * s) - (pull - 1.f) * s;
+        return select(less(t, 0.5f), in, out);
+    }
+
+    inline auto elasticOut(Vec t) -> Vec {
+        // ondulation of 2.5 : sin(2 pi (2.5 t - 1.25)) = sin(pi (5 t - 2.5))
+        const auto result = exp2(-10.f * t) * sinPi(5.f * t - 2.5f) + 1.f;
+        return select(either(equal(t, 0.f), equal(t, 1.f)), t, result);
+    }
+    inline auto elasticIn(Vec t) -> Vec { return 1.f - elasticOut(1.f - t); }
+    inline auto elasticInOut(Vec t) -> Vec {
+        constexpr float attenuation = 12.f / 25.f;
+        const auto s = sinPi((20.f * t - 11.125f) * attenuation);
+        const auto in = -exp2(20.f * t - 10.f) * s * 0.5f;
+        const auto out = exp2(10.f - 20.f * t) * s * 0.5f + 1.f;
+        return select(either(equal(t, 0.f), equal(t, 1.f)), t, select(less(t, 0.5f), in, out));
+    }
+
+    template <Vec(*Kernel)(Vec)>
+    void evaluateBatch(const float* t, float* result, std::size_t count) {
+        std::size_t i = 0;
+        for (; i + Vec::Width <= count; i += Vec::Width)
+            Kernel(Vec::load(t + i)).store(result + i);
+        // the last values are padded, to be computed like the others
+        if (i < count) {
+            float in[Vec::Width] = {}, out[Vec::Width];
+            std::memcpy(in, t + i, (count - i) * sizeof(float));
+            Kernel(Vec::load(in)).store(out);
+            std::memcpy(result + i, out, (count - i) * sizeof(float));
+        }
+    }
+
+#endif
+
+}
+}
+
+auto ns::easing::getBatchWidth() -> unsigned {
+#if defined(NS_EASING_SIMD)
+    return static_cast<unsigned>(simd::Vec::Width);
+#else
+    return 1;
+#endif
+}
+
+void ns::easing::evaluate(tween::EasingType type, const float* t, float* result, std::size_t count) {
+#if defined(NS_EASING_SIMD)
+    using tween::EasingType;
+    switch (type) {
+        case EasingType::Linear: return simd::evaluateBatch<simd::linear>(t, result, count);
+        case EasingType::QuadraticIn: return simd::evaluateBatch<simd::polynomialIn<2>>(t, result, count);
+        case EasingType::QuadraticOut: return simd::evaluateBatch<simd::polynomialOut<2>>(t, result, count);
+        case EasingType::QuadraticInOut: return simd::evaluateBatch<simd::polynomialInOut<2>>(t, result, count);
+        case EasingType::CubicIn: return simd::evaluateBatch<simd::polynomialIn<3>>(t, result, count);
+        case EasingType::CubicOut: return simd::evaluateBatch<simd::polynomialOut<3>>(t, result, count);
+        case EasingType::CubicInOut: return simd::evaluateBatch<simd::polynomialInOut<3>>(t, result, count);
+        case EasingType::SinusoidalIn: return simd::evaluateBatch<simd::sinusoidalIn>(t, result, count);
+        case EasingType::SinusoidalOut: return simd::evaluateBatch<simd::sinusoidalOut>(t, result, count);
+        case EasingType::SinusoidalInOut: return simd::evaluateBatch<simd::sinusoidalInOut>(t, result, count);
+        case EasingType::ExponentialIn: return simd::evaluateBatch<simd::exponentialIn>(t, result, count);
+        case EasingType::ExponentialOut: return simd::evaluateBatch<simd::exponentialOut>(t, result, count);
+        case EasingType::ExponentialInOut: return simd::evaluateBatch<simd::exponentialInOut>(t, result, count);
+        case EasingType::CircularIn: return simd::evaluateBatch<simd::circularIn>(t, result, count);
+        case EasingType::CircularOut: return simd::evaluateBatch<simd::circularOut>(t, result, count);
+        case EasingType::CircularInOut: return simd::evaluateBatch<simd::circularInOut>(t, result, count);
+        case EasingType::BounceIn: return simd::evaluateBatch<simd::bounceIn>(t, result, count);
+        case EasingType::BounceOut: return simd::evaluateBatch<simd::bounceOut>(t, result, count);
+        case EasingType::BounceInOut: return simd::evaluateBatch<simd::bounceInOut>(t, result, count);
+        case EasingType::BackIn: return simd::evaluateBatch<simd::backIn>(t, result, count);
+        case EasingType::BackOut: return simd::evaluateBatch<simd::backOut>(t, result, count);
+        case EasingType::BackInOut: return simd::evaluateBatch<simd::backInOut>(t, result, count);
+        case EasingType::BackIn2: return simd::evaluateBatch<simd::backIn2>(t, result, count);
+        case EasingType::BackOut2: return simd::evaluateBatch<simd::backOut2>(t, result, count);
+        case EasingType::BackInOut2: return simd::evaluateBatch<simd::backInOut2>(t, result, count);
+        case EasingType::ElasticIn: return simd::evaluateBatch<simd::elasticIn>(t, result, count);
+        case EasingType::ElasticOut: return simd::evaluateBatch<simd::elasticOut>(t, result, count);
+        case EasingType::ElasticInOut: return simd::evaluateBatch<simd::elasticInOut>(t, result, count);
+        default: break;
+    }
+#endif
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = evaluate(type, t[i]);
+}
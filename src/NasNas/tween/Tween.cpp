@@ -70,13 +70,21 @@ void Tween::onEnd(std::function<void()> fn) {
     m_on_end_cb = std::move(fn);
 }
 
+void Tween::setTimeGroup(TimeSource::Group group) {
+    m_clock.setGroup(group);
+}
+
 void Tween::restart() {
     m_index = 0;
     m_on_end_called = false;
     m_current_delay = m_initial_delay;
     m_clock.restart();
-    if (!m_starts.empty() && !m_first_run)
-        m_on_step_cbs[0](m_starts[0]);
+    if (!m_starts.empty()) {
+        // restarting is a jump, nothing to blend with
+        m_previous_value = m_value = m_starts[0];
+        if (!m_first_run)
+            m_on_step_cbs[0](m_starts[0]);
+    }
 }
 
 auto Tween::loop() -> Tween& {
@@ -95,7 +103,7 @@ auto Tween::step() -> float {
     }
 
     if (m_current_delay > 0.f) {
-        if (m_clock.getElapsedTime().asSeconds() < m_current_delay)
+        if (m_clock.getElapsedTime() < m_current_delay)
             return 0.f;
         else {
             m_current_delay = 0.f;
@@ -113,15 +121,14 @@ auto Tween::step() -> float {
             return 1.f;
     }
 
-    auto pt = m_clock.getElapsedTime().asSeconds() / m_durations[m_index];
+    auto pt = m_clock.getElapsedTime() / m_durations[m_index];
 
     auto& easing_fn = m_easing_fns[m_index];
-    auto& callback = m_on_step_cbs[m_index];
 
     if (pt < 1.f)
-        callback(interpolate(m_index, easing_fn(pt)));
+        setValue(m_index, interpolate(m_index, easing_fn(pt)));
     else {
-        callback(m_ends[m_index]);
+        setValue(m_index, m_ends[m_index]);
         m_clock.restart();
         m_current_delay = m_delays[m_index];
         m_index += 1;
@@ -129,6 +136,16 @@ auto Tween::step() -> float {
     return std::clamp(pt, 0.f, 1.f);
 }
 
+auto Tween::getValue(float alpha) const -> float {
+    return m_previous_value + (m_value - m_previous_value) * alpha;
+}
+
+void Tween::setValue(unsigned i, float value) {
+    m_previous_value = m_value;
+    m_value = value;
+    m_on_step_cbs[i](value);
+}
+
 void Tween::emplaceAnimation() {
     m_durations.emplace_back(1.f);
     m_delays.emplace_back(0.f);
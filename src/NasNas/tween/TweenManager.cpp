@@ -0,0 +1,303 @@
+#include <NasNas/tween/TweenManager.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace ns;
+
+TweenId::TweenId(std::uint32_t index, std::uint32_t generation) :
+m_index(index),
+m_generation(generation)
+{}
+
+auto TweenId::isValid() const -> bool {
+    return m_index != Invalid;
+}
+
+auto TweenId::operator==(const TweenId& other) const -> bool {
+    return m_index == other.m_index && m_generation == other.m_generation;
+}
+
+auto TweenId::operator!=(const TweenId& other) const -> bool {
+    return !(*this == other);
+}
+
+auto TweenManager::add(float start, float end, float duration, tween::EasingType easing) -> TweenId {
+    return add(nullptr, start, end, duration, easing);
+}
+
+auto TweenManager::add(float* target, float start, float end, float duration, tween::EasingType easing) -> TweenId {
+    std::uint32_t slot;
+    if (!m_free_slots.empty()) {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    }
+    else {
+        slot = static_cast<std::uint32_t>(m_dense_indices.size());
+        m_dense_indices.push_back(0);
+        m_generations.push_back(0);
+        m_end_callbacks.emplace_back();
+        m_step_callbacks_indices.push_back(TweenId::Invalid);
+    }
+    m_dense_indices[slot] = static_cast<std::uint32_t>(m_values.size());
+
+    m_starts.push_back(start);
+    m_deltas.push_back(end - start);
+    // a null duration ends on the first update
+    m_inverse_durations.push_back(1.f / std::max(duration, std::numeric_limits<float>::min()));
+    m_elapsed.push_back(0.f);
+    m_delays.push_back(0.f);
+    m_values.push_back(start);
+    m_easings.push_back(easing);
+    m_flags.push_back(0);
+    m_targets.push_back(target);
+    m_slots.push_back(slot);
+    return {slot, m_generations[slot]};
+}
+
+void TweenManager::setDelay(TweenId id, float delay) {
+    if (auto i = getDenseIndex(id); i != TweenId::Invalid)
+        m_delays[i] = delay;
+}
+
+void TweenManager::setLoop(TweenId id, bool loop) {
+    if (auto i = getDenseIndex(id); i != TweenId::Invalid)
+        m_flags[i] = loop ? (m_flags[i] | Loop) : (m_flags[i] & ~Loop);
+}
+
+void TweenManager::setTarget(TweenId id, float* target) {
+    if (auto i = getDenseIndex(id); i != TweenId::Invalid)
+        m_targets[i] = target;
+}
+
+void TweenManager::onStep(TweenId id, tween::CallbackFunction callback) {
+    if (getDenseIndex(id) == TweenId::Invalid)
+        return;
+    // the callbacks being called must stay in place until the end of the update
+    if (m_updating) {
+        m_added_step_callbacks.push_back({id, std::move(callback)});
+        return;
+    }
+    setStepCallback({id, std::move(callback)});
+}
+
+void TweenManager::onEnd(TweenId id, std::function<void()> callback) {
+    if (getDenseIndex(id) != TweenId::Invalid)
+        m_end_callbacks[id.m_index] = std::move(callback);
+}
+
+void TweenManager::remove(TweenId id) {
+    if (getDenseIndex(id) == TweenId::Invalid)
+        return;
+    if (m_updating) {
+        m_removed.push_back(id);
+        return;
+    }
+    erase(id);
+    removeStepCallbacks();
+}
+
+auto TweenManager::isRunning(TweenId id) const -> bool {
+    return getDenseIndex(id) != TweenId::Invalid;
+}
+
+auto TweenManager::getValue(TweenId id) const -> float {
+    auto i = getDenseIndex(id);
+    return i == TweenId::Invalid ? 0.f : m_values[i];
+}
+
+void TweenManager::update(float dt) {
+    const auto count = m_values.size();
+    m_updating = true;
+    m_progress.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto elapsed = (m_elapsed[i] += dt);
+        auto x = (elapsed - m_delays[i]) * m_inverse_durations[i];
+        if (x < 0.f) {
+            m_flags[i] &= ~Stepped;
+            m_progress[i] = 0.f;
+            continue;
+        }
+        m_flags[i] |= Stepped;
+        if (x >= 1.f) {
+            if (m_flags[i] & Loop) {
+                x -= std::floor(x);
+                m_elapsed[i] = m_delays[i] + x / m_inverse_durations[i];
+            }
+            else {
+                x = 1.f;
+                if (!(m_flags[i] & Ended)) {
+                    m_flags[i] |= Ended;
+                    m_ended.push_back({m_slots[i], m_generations[m_slots[i]]});
+                }
+            }
+        }
+        m_progress[i] = x;
+    }
+
+    evaluateEasings();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!(m_flags[i] & Stepped))
+            continue;
+        const auto value = m_starts[i] + m_deltas[i] * m_progress[i];
+        m_values[i] = value;
+        if (m_targets[i] != nullptr)
+            *m_targets[i] = value;
+    }
+
+    for (auto& [id, callback] : m_step_callbacks) {
+        const auto i = getDenseIndex(id);
+        if (i != TweenId::Invalid && (m_flags[i] & Stepped))
+            callback(m_values[i]);
+    }
+
+    for (std::size_t k = 0; k < m_ended.size(); ++k) {
+        const auto id = m_ended[k];
+        if (getDenseIndex(id) == TweenId::Invalid)
+            continue;
+        auto callback = std::move(m_end_callbacks[id.m_index]);
+        if (callback)
+            callback();
+        m_removed.push_back(id);
+    }
+    m_ended.clear();
+
+    m_updating = false;
+    for (const auto& id : m_removed)
+        if (getDenseIndex(id) != TweenId::Invalid)
+            erase(id);
+    if (!m_removed.empty())
+        removeStepCallbacks();
+    m_removed.clear();
+    for (auto& step_callback : m_added_step_callbacks)
+        if (getDenseIndex(step_callback.id) != TweenId::Invalid)
+            setStepCallback(std::move(step_callback));
+    m_added_step_callbacks.clear();
+}
+
+void TweenManager::clear() {
+    for (auto slot : m_slots)
+        m_free_slots.push_back(slot);
+    for (auto& callback : m_end_callbacks)
+        callback = nullptr;
+    for (auto slot : m_slots)
+        m_generations[slot]++;
+    m_starts.clear();
+    m_deltas.clear();
+    m_inverse_durations.clear();
+    m_elapsed.clear();
+    m_delays.clear();
+    m_values.clear();
+    m_easings.clear();
+    m_flags.clear();
+    m_targets.clear();
+    m_slots.clear();
+    m_step_callbacks.clear();
+    m_added_step_callbacks.clear();
+    m_ended.clear();
+    m_removed.clear();
+}
+
+auto TweenManager::getCount() const -> std::size_t {
+    return m_values.size();
+}
+
+void TweenManager::evaluateEasings() {
+    const auto count = m_progress.size();
+    constexpr auto types_count = static_cast<std::size_t>(tween::EasingType::Count);
+    std::array<std::uint32_t, types_count + 1> offsets = {};
+    for (auto easing : m_easings)
+        offsets[static_cast<std::size_t>(easing) + 1]++;
+
+    // a single easing function, no need to group the values
+    for (std::size_t type = 0; type < types_count; ++type) {
+        if (offsets[type + 1] == count) {
+            easing::evaluate(static_cast<tween::EasingType>(type), m_progress.data(), m_progress.data(), count);
+            return;
+        }
+    }
+
+    // the progress values are grouped by easing function, to be evaluated in batches
+    for (std::size_t type = 0; type < types_count; ++type)
+        offsets[type + 1] += offsets[type];
+    auto positions = offsets;
+    m_order.resize(count);
+    m_batch.resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto position = positions[static_cast<std::size_t>(m_easings[i])]++;
+        m_order[position] = i;
+        m_batch[position] = m_progress[i];
+    }
+    for (std::size_t type = 0; type < types_count; ++type) {
+        if (offsets[type + 1] > offsets[type])
+            easing::evaluate(static_cast<tween::EasingType>(type), m_batch.data() + offsets[type], m_batch.data() + offsets[type], offsets[type + 1] - offsets[type]);
+    }
+    for (std::size_t position = 0; position < count; ++position)
+        m_progress[m_order[position]] = m_batch[position];
+}
+
+auto TweenManager::getDenseIndex(TweenId id) const -> std::uint32_t {
+    if (id.m_index >= m_generations.size() || m_generations[id.m_index] != id.m_generation)
+        return TweenId::Invalid;
+    return m_dense_indices[id.m_index];
+}
+
+void TweenManager::erase(TweenId id) {
+    const auto i = m_dense_indices[id.m_index];
+    const auto last = m_values.size() - 1;
+    // the last tween takes the place of the removed one
+    if (i != last) {
+        m_starts[i] = m_starts[last];
+        m_deltas[i] = m_deltas[last];
+        m_inverse_durations[i] = m_inverse_durations[last];
+        m_elapsed[i] = m_elapsed[last];
+        m_delays[i] = m_delays[last];
+        m_values[i] = m_values[last];
+        m_easings[i] = m_easings[last];
+        m_flags[i] = m_flags[last];
+        m_targets[i] = m_targets[last];
+        m_slots[i] = m_slots[last];
+        m_dense_indices[m_slots[i]] = i;
+    }
+    m_starts.pop_back();
+    m_deltas.pop_back();
+    m_inverse_durations.pop_back();
+    m_elapsed.pop_back();
+    m_delays.pop_back();
+    m_values.pop_back();
+    m_easings.pop_back();
+    m_flags.pop_back();
+    m_targets.pop_back();
+    m_slots.pop_back();
+
+    m_end_callbacks[id.m_index] = nullptr;
+    m_generations[id.m_index]++;
+    m_free_slots.push_back(id.m_index);
+}
+
+void TweenManager::setStepCallback(StepCallback step_callback) {
+    auto& index = m_step_callbacks_indices[step_callback.id.m_index];
+    if (index < m_step_callbacks.size() && m_step_callbacks[index].id == step_callback.id) {
+        m_step_callbacks[index].callback = std::move(step_callback.callback);
+        return;
+    }
+    index = static_cast<std::uint32_t>(m_step_callbacks.size());
+    m_step_callbacks.push_back(std::move(step_callback));
+}
+
+void TweenManager::removeStepCallbacks() {
+    // in a single pass for all the tweens removed by an update, keeping the callbacks order
+    std::size_t kept = 0;
+    for (auto& step_callback : m_step_callbacks) {
+        if (getDenseIndex(step_callback.id) == TweenId::Invalid)
+            continue;
+        m_step_callbacks_indices[step_callback.id.m_index] = static_cast<std::uint32_t>(kept);
+        if (&m_step_callbacks[kept] != &step_callback)
+            m_step_callbacks[kept] = std::move(step_callback);
+        kept++;
+    }
+    m_step_callbacks.resize(kept);
+}
@@ -32,6 +32,10 @@ void NineSlice::setTexture(const sf::Texture& texture, bool reset_rect) {
         m_texture_rect = ns::FloatRect(0, 0, size.x, size.y);
 }
 
+auto NineSlice::getTexture() const -> const sf::Texture* {
+    return m_texture;
+}
+
 void NineSlice::setTextureRect(const sf::IntRect& rect) {
     m_texture_rect = rect;
 }
@@ -73,6 +77,12 @@ auto NineSlice::getGlobalBounds() const -> sf::FloatRect {
     return getTransform().transformRect(m_vertices.getBounds());
 }
 
+void NineSlice::batchTriangles(std::vector<sf::Vertex>& vertices) const {
+    const auto& transform = getTransform();
+    for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i)
+        vertices.emplace_back(transform.transformPoint(m_vertices[i].position), m_vertices[i].color, m_vertices[i].texCoords);
+}
+
 void NineSlice::draw(sf::RenderTarget& target, sf::RenderStates states) const {
     states.transform *= getTransform();
     states.texture = m_texture;
@@ -0,0 +1,50 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include <NasNas/reslib/Pack.hpp>
+
+/**
+ * Builds a pack from an assets directory, then lists its entries.
+ *
+ * Usage : NasNas_pack <directory> [output] [--no-compression]
+ * The output defaults to the directory name followed by the pack extension, next to the directory.
+ */
+int main(int argc, char** argv) {
+    std::string directory, output;
+    bool compress = true;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-compression") == 0)
+            compress = false;
+        else if (directory.empty())
+            directory = argv[i];
+        else if (output.empty())
+            output = argv[i];
+    }
+    if (directory.empty()) {
+        std::cout << "Usage : NasNas_pack <directory> [output] [--no-compression]" << std::endl;
+        return 1;
+    }
+    while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\'))
+        directory.pop_back();
+    if (output.empty())
+        output = directory + ns::Pack::Extension;
+
+    if (!ns::Pack::build(directory, output, compress))
+        return 1;
+
+    ns::Pack pack;
+    if (!pack.open(output))
+        return 1;
+    std::size_t size = 0, stored_size = 0;
+    for (const auto& entry : pack.getEntries()) {
+        std::cout << entry.path << " : " << entry.size << " bytes";
+        if (entry.compression != ns::Pack::Compression::None)
+            std::cout << ", compressed to " << entry.stored_size << " bytes";
+        std::cout << '\n';
+        size += entry.size;
+        stored_size += entry.stored_size;
+    }
+    std::cout << output << " : " << pack.getEntries().size() << " files, " << size << " bytes stored in " << stored_size << " bytes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <NasNas/reslib/RawTexture.hpp>
+
+/**
+ * Converts images to raw textures, written next to the images : "image.png" gives "image.png.nstex".
+ * The ResourceManager and the packs then use the raw textures instead of the images.
+ *
+ * Usage : NasNas_texture <image or directory>... [--smooth] [--mipmap]
+ * Directories are converted recursively.
+ */
+int main(int argc, char** argv) {
+    namespace fs = std::filesystem;
+    const std::set<std::string> extensions = {".png", ".jpg", ".bmp"};
+    std::vector<fs::path> inputs;
+    std::uint32_t flags = ns::RawTexture::None;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--smooth") == 0)
+            flags |= ns::RawTexture::Smooth;
+        else if (std::strcmp(argv[i], "--mipmap") == 0)
+            flags |= ns::RawTexture::Mipmap | ns::RawTexture::Smooth;
+        else
+            inputs.emplace_back(argv[i]);
+    }
+    if (inputs.empty()) {
+        std::cout << "Usage : NasNas_texture <image or directory>... [--smooth] [--mipmap]" << std::endl;
+        return 1;
+    }
+
+    std::vector<fs::path> images;
+    for (const auto& input : inputs) {
+        if (fs::is_directory(input)) {
+            for (const auto& file : fs::recursive_directory_iterator(input))
+                if (file.is_regular_file() && extensions.count(file.path().extension().string()) != 0)
+                    images.push_back(file.path());
+        }
+        else {
+            images.push_back(input);
+        }
+    }
+
+    std::size_t failed = 0;
+    for (const auto& path : images) {
+        sf::Image image;
+        const auto output = path.string() + ns::RawTexture::Extension;
+        if (!image.loadFromFile(path.string()) || !ns::RawTexture::convert(image, output, flags)) {
+            failed++;
+            continue;
+        }
+        std::cout << path.generic_string() << " : " << image.getSize().x << "x" << image.getSize().y
+                  << ", " << fs::file_size(path) << " bytes -> " << fs::file_size(output) << " bytes" << '\n';
+    }
+    std::cout << images.size() - failed << " images converted";
+    if (failed > 0)
+        std::cout << ", " << failed << " failed";
+    std::cout << std::endl;
+    return failed == 0 ? 0 : 1;
+}